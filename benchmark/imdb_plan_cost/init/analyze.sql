@@ -0,0 +1,23 @@
+SET storage_compatibility_version='latest';
+ANALYZE aka_name;
+ANALYZE aka_title;
+ANALYZE cast_info;
+ANALYZE char_name;
+ANALYZE comp_cast_type;
+ANALYZE company_name;
+ANALYZE company_type;
+ANALYZE complete_cast;
+ANALYZE info_type;
+ANALYZE keyword;
+ANALYZE kind_type;
+ANALYZE link_type;
+ANALYZE movie_companies;
+ANALYZE movie_info;
+ANALYZE movie_info_idx;
+ANALYZE movie_keyword;
+ANALYZE movie_link;
+ANALYZE name;
+ANALYZE person_info;
+ANALYZE role_type;
+ANALYZE title;
+CHECKPOINT;
@@ -0,0 +1,61 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+using namespace duckdb;
+
+//////////////////
+// POINT LOOKUP //
+//////////////////
+struct DuckDBPointLookupState : public DuckDBBenchmarkState {
+	duckdb::unique_ptr<PreparedStatement> prepared;
+
+	DuckDBPointLookupState(string path) : DuckDBBenchmarkState(path) {
+	}
+	virtual ~DuckDBPointLookupState() {
+	}
+};
+
+#define POINT_LOOKUP_BENCHMARK(CREATE_STATEMENT, LOOKUP_STATEMENT, ROW_COUNT)                                          \
+	duckdb::unique_ptr<DuckDBBenchmarkState> CreateBenchmarkState() override {                                         \
+		auto result = make_uniq<DuckDBPointLookupState>(GetDatabasePath());                                            \
+		return std::move(result);                                                                                      \
+	}                                                                                                                  \
+	void Load(DuckDBBenchmarkState *state_p) override {                                                                \
+		auto state = (DuckDBPointLookupState *)state_p;                                                                \
+		state->conn.Query(CREATE_STATEMENT);                                                                           \
+		state->prepared = state->conn.Prepare(LOOKUP_STATEMENT);                                                       \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state_p) override {                                                        \
+		auto state = (DuckDBPointLookupState *)state_p;                                                                \
+		for (int32_t i = 0; i < 10000; i++) {                                                                          \
+			vector<Value> values {Value::INTEGER((i * 7919) % ROW_COUNT)};                                             \
+			state->result = state->prepared->Execute(values, false);                                                   \
+			if (state->result->HasError()) {                                                                           \
+				return;                                                                                                \
+			}                                                                                                          \
+		}                                                                                                              \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		if (result->HasError()) {                                                                                      \
+			return result->GetError();                                                                                 \
+		}                                                                                                              \
+		auto &materialized = result->Cast<MaterializedQueryResult>();                                                  \
+		if (materialized.RowCount() != 1) {                                                                            \
+			return "Expected the lookup to find a single row, but found " + std::to_string(materialized.RowCount());   \
+		}                                                                                                              \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Run 10K point lookups using a prepared statement, this measures the per-query overhead";               \
+	}
+
+DUCKDB_BENCHMARK(PointLookupPrimaryKeyPREPARED, "[point_lookup]")
+POINT_LOOKUP_BENCHMARK("CREATE TABLE lookup(id INTEGER PRIMARY KEY, v VARCHAR);"
+                       "INSERT INTO lookup SELECT range, range::VARCHAR FROM range(1000000);",
+                       "SELECT * FROM lookup WHERE id = $1", 1000000)
+FINISH_BENCHMARK(PointLookupPrimaryKeyPREPARED)
+
+DUCKDB_BENCHMARK(PointLookupSmallTablePREPARED, "[point_lookup]")
+POINT_LOOKUP_BENCHMARK("CREATE TABLE lookup AS SELECT range::INTEGER AS id, range::VARCHAR AS v FROM range(1000);",
+                       "SELECT * FROM lookup WHERE id = $1", 1000)
+FINISH_BENCHMARK(PointLookupSmallTablePREPARED)
@@ -28,6 +28,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -994,6 +995,23 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			break;
+		}
+		unique_ptr<ConstantFilter> constant_filter;
+		{
+			lock_guard<mutex> l(dynamic_filter.filter_data->lock);
+			if (!dynamic_filter.filter_data->initialized) {
+				break;
+			}
+			constant_filter = make_uniq<ConstantFilter>(dynamic_filter.filter_data->filter->comparison_type,
+			                                            dynamic_filter.filter_data->filter->constant);
+		}
+		ApplyFilter(v, *constant_filter, filter_mask, count);
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -18,8 +18,10 @@ BANNER_SIZE = 52
 
 def print_usage():
     print(
-        f"Expected usage: python3 scripts/{os.path.basename(__file__)} --old=/old/duckdb_cli --new=/new/duckdb_cli --dir=/path/to/benchmark/dir"
+        f"Expected usage: python3 scripts/{os.path.basename(__file__)} --old=/old/duckdb_cli --new=/new/duckdb_cli --dir=/path/to/benchmark/dir [--analyze]"
     )
+    print("With --analyze, init/analyze.sql is run on the new database only, so that passing the same CLI as --old and")
+    print("--new reports the plan cost before and after ANALYZE")
     exit(1)
 
 
@@ -27,6 +29,7 @@ def parse_args():
     old = None
     new = None
     benchmark_dir = None
+    analyze = False
     for arg in sys.argv[1:]:
         if arg.startswith("--old="):
             old = arg.replace("--old=", "")
@@ -34,19 +37,25 @@ def parse_args():
             new = arg.replace("--new=", "")
         elif arg.startswith("--dir="):
             benchmark_dir = arg.replace("--dir=", "")
+        elif arg == "--analyze":
+            analyze = True
         else:
             print_usage()
     if old == None or new == None or benchmark_dir == None:
         print_usage()
-    return old, new, benchmark_dir
+    return old, new, benchmark_dir, analyze
 
 
-def init_db(cli, dbname, benchmark_dir):
+def init_db(cli, dbname, benchmark_dir, analyze=False):
     print(f"INITIALIZING {dbname} ...")
     subprocess.run(
         f"{cli} {dbname} < {benchmark_dir}/init/schema.sql", shell=True, check=True, stdout=subprocess.DEVNULL
     )
     subprocess.run(f"{cli} {dbname} < {benchmark_dir}/init/load.sql", shell=True, check=True, stdout=subprocess.DEVNULL)
+    if analyze:
+        subprocess.run(
+            f"{cli} {dbname} < {benchmark_dir}/init/analyze.sql", shell=True, check=True, stdout=subprocess.DEVNULL
+        )
     print("INITIALIZATION DONE")
 
 
@@ -171,9 +180,9 @@ def print_diffs(diffs):
 
 
 def main():
-    old, new, benchmark_dir = parse_args()
+    old, new, benchmark_dir, analyze = parse_args()
     init_db(old, OLD_DB_NAME, benchmark_dir)
-    init_db(new, NEW_DB_NAME, benchmark_dir)
+    init_db(new, NEW_DB_NAME, benchmark_dir, analyze)
 
     improvements = []
     regressions = []
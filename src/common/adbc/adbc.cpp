@@ -7,6 +7,8 @@
 #include "duckdb.h"
 #include "duckdb/common/arrow/arrow_wrapper.hpp"
 #include "duckdb/common/arrow/nanoarrow/nanoarrow.hpp"
+#include "duckdb/common/arrow/physical_buffered_arrow_collector.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
 
 #include "duckdb/main/capi/capi_internal.hpp"
 
@@ -60,6 +62,9 @@ AdbcStatusCode duckdb_adbc_init(int version, void *driver, struct AdbcError *err
 namespace duckdb_adbc {
 
 enum class IngestionMode { CREATE = 0, APPEND = 1 };
+//! The number of rows in the record batches of a result stream
+static constexpr duckdb::idx_t ARROW_STREAM_BATCH_SIZE = 1000000;
+
 struct DuckDBAdbcStatementWrapper {
 	::duckdb_connection connection;
 	::duckdb_arrow result;
@@ -738,6 +743,47 @@ static AdbcStatusCode IngestToTableFromBoundStream(DuckDBAdbcStatementWrapper *s
 	return Ingest(statement->connection, statement->ingestion_table_name, &stream, error, statement->ingestion_mode);
 }
 
+//! Whether results are streamed (arrow_streaming_results). A streamed result is only valid until the connection
+//! executes another query, so by default the result is materialized instead
+static bool StreamArrowResults(DuckDBAdbcStatementWrapper *wrapper) {
+	auto prepared_wrapper = reinterpret_cast<duckdb::PreparedStatementWrapper *>(wrapper->statement);
+	if (!prepared_wrapper || !prepared_wrapper->statement || prepared_wrapper->statement->HasError()) {
+		return false;
+	}
+	auto &context = *prepared_wrapper->statement->context;
+	return duckdb::DBConfig::GetConfig(context).options.arrow_streaming_results;
+}
+
+//! Streams the result of the statement as Arrow record batches, which are produced by the pipeline threads
+static AdbcStatusCode ExecuteToArrowStream(DuckDBAdbcStatementWrapper *wrapper, struct ArrowArrayStream *out,
+                                           struct AdbcError *error) {
+	auto prepared_wrapper = reinterpret_cast<duckdb::PreparedStatementWrapper *>(wrapper->statement);
+	auto &prepared = *prepared_wrapper->statement;
+	duckdb::unique_ptr<duckdb::QueryResult> result;
+	{
+		auto &config = duckdb::ClientConfig::GetConfig(*prepared.context);
+		duckdb::ScopedConfigSetting setting(
+		    config,
+		    [](duckdb::ClientConfig &config) {
+			    config.streaming_result_collector = [](duckdb::ClientContext &context,
+			                                           duckdb::PreparedStatementData &data) {
+				    return duckdb::PhysicalBufferedArrowCollector::Create(context, data, ARROW_STREAM_BATCH_SIZE);
+			    };
+		    },
+		    [](duckdb::ClientConfig &config) { config.streaming_result_collector = nullptr; });
+		result = prepared.Execute(prepared_wrapper->values, true);
+	}
+	if (result->HasError()) {
+		SetError(error, result->GetError());
+		return ADBC_STATUS_INVALID_ARGUMENT;
+	}
+	// the stream wrapper is destroyed when the consumer releases the stream
+	auto stream_wrapper = new duckdb::ResultArrowArrayStreamWrapper(std::move(result), ARROW_STREAM_BATCH_SIZE);
+	*out = stream_wrapper->stream;
+	stream_wrapper->stream.release = nullptr;
+	return ADBC_STATUS_OK;
+}
+
 AdbcStatusCode StatementExecuteQuery(struct AdbcStatement *statement, struct ArrowArrayStream *out,
                                      int64_t *rows_affected, struct AdbcError *error) {
 	if (!statement) {
@@ -825,6 +871,8 @@ AdbcStatusCode StatementExecuteQuery(struct AdbcStatement *statement, struct Arr
 				return ADBC_STATUS_INVALID_ARGUMENT;
 			}
 		}
+	} else if (out && StreamArrowResults(wrapper)) {
+		return ExecuteToArrowStream(wrapper, out, error);
 	} else {
 		auto res = duckdb_execute_prepared_arrow(wrapper->statement, &wrapper->result);
 		if (res != DuckDBSuccess) {
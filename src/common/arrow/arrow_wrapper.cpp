@@ -128,6 +128,22 @@ int ResultArrowArrayStreamWrapper::MyStreamGetNext(struct ArrowArrayStream *stre
 		my_stream->column_types = result.types;
 		my_stream->column_names = result.names;
 	}
+	if (result.type == QueryResultType::STREAM_RESULT && result.Cast<StreamQueryResult>().ProducesArrowArrays()) {
+		// the record batches were already produced by the pipeline threads
+		auto array = result.Cast<StreamQueryResult>().FetchArrowArray();
+		if (result.HasError()) {
+			my_stream->last_error = result.GetErrorObject();
+			return -1;
+		}
+		if (!array) {
+			// Nothing to output
+			out->release = nullptr;
+			return 0;
+		}
+		*out = array->arrow_array;
+		array->arrow_array.release = nullptr;
+		return 0;
+	}
 	idx_t result_count;
 	ErrorData error;
 	if (!ArrowUtil::TryFetchChunk(scan_state, result.client_properties, my_stream->batch_size, out, result_count,
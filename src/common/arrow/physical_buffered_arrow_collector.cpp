@@ -0,0 +1,151 @@
+#include "duckdb/common/arrow/physical_buffered_arrow_collector.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/main/stream_query_result.hpp"
+
+namespace duckdb {
+
+PhysicalBufferedArrowCollector::PhysicalBufferedArrowCollector(PreparedStatementData &data, bool parallel,
+                                                               bool use_batch_index, idx_t batch_size)
+    : PhysicalResultCollector(data), record_batch_size(batch_size), parallel(parallel),
+      use_batch_index(use_batch_index) {
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalBufferedArrowCollector::Create(ClientContext &context,
+                                                                           PreparedStatementData &data,
+                                                                           idx_t batch_size) {
+	if (batch_size == 0) {
+		throw InvalidInputException("The record batch size of an Arrow stream must be higher than 0");
+	}
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: record batches are streamed in the order in which they are produced
+		return make_uniq_base<PhysicalResultCollector, PhysicalBufferedArrowCollector>(data, true, false, batch_size);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: produce the record batches on one thread
+		return make_uniq_base<PhysicalResultCollector, PhysicalBufferedArrowCollector>(data, false, false,
+		                                                                               batch_size);
+	}
+	// the batch index determines the order in which the record batches are streamed
+	return make_uniq_base<PhysicalResultCollector, PhysicalBufferedArrowCollector>(data, true, true, batch_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class BufferedArrowCollectorGlobalState : public GlobalSinkState {
+public:
+	weak_ptr<ClientContext> context;
+	shared_ptr<BufferedData> buffered_data;
+};
+
+void PhysicalBufferedArrowCollector::FlushRecordBatch(ArrowBufferedData &buffered_data,
+                                                      BufferedArrowCollectorLocalState &lstate) const {
+	if (!lstate.appender) {
+		return;
+	}
+	auto array = make_uniq<ArrowArrayWrapper>();
+	array->arrow_array = lstate.appender->Finalize();
+	lstate.appender.reset();
+	buffered_data.Append(std::move(array), lstate.allocation_size, lstate.current_batch);
+	lstate.allocation_size = 0;
+}
+
+SinkResultType PhysicalBufferedArrowCollector::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                    OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<BufferedArrowCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<BufferedArrowCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	if (use_batch_index) {
+		lstate.current_batch = lstate.partition_info.batch_index.GetIndex();
+		buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	}
+	if (buffered_data.ShouldBlockBatch(lstate.current_batch)) {
+		buffered_data.BlockSink(input.interrupt_state, lstate.current_batch);
+		return SinkResultType::BLOCKED;
+	}
+
+	// the chunk is converted on the thread that produced it, so the record batches are created in parallel
+	auto count = chunk.size();
+	D_ASSERT(count != 0);
+	auto chunk_allocation_size = chunk.GetAllocationSize();
+	idx_t processed = 0;
+	do {
+		if (!lstate.appender) {
+			auto initial_capacity = MinValue(record_batch_size, count - processed);
+			lstate.appender =
+			    make_uniq<ArrowAppender>(types, initial_capacity, context.client.GetClientProperties());
+		}
+		auto row_count = lstate.appender->RowCount();
+		D_ASSERT(record_batch_size > row_count);
+		auto to_append = MinValue(record_batch_size - row_count, count - processed);
+		lstate.appender->Append(chunk, processed, processed + to_append, count);
+		lstate.allocation_size += chunk_allocation_size * to_append / count;
+		processed += to_append;
+		if (lstate.appender->RowCount() >= record_batch_size) {
+			FlushRecordBatch(buffered_data, lstate);
+		}
+	} while (processed < count);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkNextBatchType PhysicalBufferedArrowCollector::NextBatch(ExecutionContext &context,
+                                                            OperatorSinkNextBatchInput &input) const {
+	auto &gstate = input.global_state.Cast<BufferedArrowCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<BufferedArrowCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	// the previous batch is complete: hand over its last record batch
+	FlushRecordBatch(buffered_data, lstate);
+	lstate.current_batch = lstate.partition_info.batch_index.GetIndex();
+	buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	return SinkNextBatchType::READY;
+}
+
+SinkCombineResultType PhysicalBufferedArrowCollector::Combine(ExecutionContext &context,
+                                                              OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<BufferedArrowCollectorGlobalState>();
+	auto &lstate = input.local_state.Cast<BufferedArrowCollectorLocalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	FlushRecordBatch(buffered_data, lstate);
+	if (use_batch_index) {
+		buffered_data.UpdateMinBatchIndex(lstate.partition_info.min_batch_index.GetIndex());
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalBufferedArrowCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                          OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<BufferedArrowCollectorGlobalState>();
+	auto &buffered_data = gstate.buffered_data->Cast<ArrowBufferedData>();
+
+	// all batches are complete, so all remaining record batches can be read
+	buffered_data.UpdateMinBatchIndex(NumericLimits<idx_t>::Maximum());
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalBufferedArrowCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<BufferedArrowCollectorLocalState>();
+}
+
+unique_ptr<GlobalSinkState> PhysicalBufferedArrowCollector::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<BufferedArrowCollectorGlobalState>();
+	state->context = context.shared_from_this();
+	state->buffered_data = make_shared_ptr<ArrowBufferedData>(state->context);
+	return std::move(state);
+}
+
+unique_ptr<QueryResult> PhysicalBufferedArrowCollector::GetResult(GlobalSinkState &state) {
+	auto &gstate = state.Cast<BufferedArrowCollectorGlobalState>();
+	auto cc = gstate.context.lock();
+	auto result = make_uniq<StreamQueryResult>(statement_type, properties, types, names, cc->GetClientProperties(),
+	                                           gstate.buffered_data);
+	return std::move(result);
+}
+
+} // namespace duckdb
@@ -5102,6 +5102,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -5276,6 +5278,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -7169,6 +7174,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7194,6 +7201,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
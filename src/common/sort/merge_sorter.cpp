@@ -9,15 +9,24 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
+	const bool k_way = state.merge_ways > 2;
 	while (true) {
 		{
 			lock_guard<mutex> pair_guard(state.lock);
 			if (state.pair_idx == state.num_pairs) {
 				break;
 			}
-			GetNextPartition();
+			if (k_way) {
+				GetNextKWayPartition();
+			} else {
+				GetNextPartition();
+			}
+		}
+		if (k_way) {
+			MergeKWayPartition();
+		} else {
+			MergePartition();
 		}
-		MergePartition();
 	}
 }
 
@@ -141,6 +150,12 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 	if (r_idx < state.r_start) {
 		return 1;
 	}
+	return CompareAtGlobalIndex(l, r, l_idx, r_idx);
+}
+
+int MergeSorter::CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
+	D_ASSERT(l_idx < l.sb->Count());
+	D_ASSERT(r_idx < r.sb->Count());
 
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
@@ -660,4 +675,342 @@ void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count,
 	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
 }
 
+//===--------------------------------------------------------------------===//
+// K-Way Merge
+//===--------------------------------------------------------------------===//
+void MergeSorter::GetNextKWayPartition() {
+	// Create result block
+	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	// Determine which blocks must be merged
+	const idx_t group_start = state.pair_idx * state.merge_ways;
+	const idx_t ways = MinValue(state.merge_ways, state.sorted_blocks.size() - group_start);
+	D_ASSERT(ways >= 2);
+	// Initialize the readers
+	way_readers.clear();
+	way_inputs.resize(ways);
+	idx_t start = 0;
+	idx_t total = 0;
+	for (idx_t way = 0; way < ways; way++) {
+		way_readers.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		way_readers[way]->sb = state.sorted_blocks[group_start + way].get();
+		start += state.way_starts[way];
+		total += way_readers[way]->sb->Count();
+	}
+	// Compute the work that this thread must do using Merge Path
+	vector<idx_t> splits(ways);
+	if (start + state.block_capacity < total) {
+		GetKWayIntersection(start + state.block_capacity, splits);
+	} else {
+		for (idx_t way = 0; way < ways; way++) {
+			splits[way] = way_readers[way]->sb->Count();
+		}
+	}
+	// Create slices of the data that this thread must merge
+	for (idx_t way = 0; way < ways; way++) {
+		auto &reader = *way_readers[way];
+		reader.SetIndices(0, 0);
+		way_inputs[way] = reader.sb->CreateSlice(state.way_starts[way], splits[way], reader.entry_idx);
+		reader.sb = way_inputs[way].get();
+		state.way_starts[way] = splits[way];
+	}
+	// Update global state
+	if (start + state.block_capacity >= total) {
+		// Delete references to the previous group
+		for (idx_t way = 0; way < ways; way++) {
+			state.sorted_blocks[group_start + way] = nullptr;
+		}
+		// Advance group
+		state.pair_idx++;
+		state.way_starts.assign(state.merge_ways, 0);
+	}
+}
+
+void MergeSorter::GetKWayIntersection(const idx_t rank, vector<idx_t> &splits) {
+	// We search for the offsets such that exactly 'rank' tuples of the group precede them
+	// Tuples are ordered by their sorting key and then by the reader they belong to, so the offsets are unique
+	// The offsets of the previous partition are a lower bound, and no offset can advance more than the partition size
+	const idx_t ways = way_readers.size();
+	idx_t start = 0;
+	for (idx_t way = 0; way < ways; way++) {
+		start += state.way_starts[way];
+	}
+	D_ASSERT(rank > start);
+	vector<idx_t> lo(ways);
+	vector<idx_t> hi(ways);
+	vector<idx_t> preceding(ways);
+	for (idx_t way = 0; way < ways; way++) {
+		lo[way] = state.way_starts[way];
+		hi[way] = MinValue(way_readers[way]->sb->Count(), lo[way] + rank - start);
+	}
+	while (true) {
+		// Bisect the largest remaining search range
+		idx_t pivot = 0;
+		for (idx_t way = 1; way < ways; way++) {
+			if (hi[way] - lo[way] > hi[pivot] - lo[pivot]) {
+				pivot = way;
+			}
+		}
+		if (hi[pivot] == lo[pivot]) {
+			break;
+		}
+		const idx_t idx = lo[pivot] + (hi[pivot] - lo[pivot]) / 2;
+		// Compute the rank of this tuple, only counting within the current search ranges
+		// Counts outside of the search ranges are clamped, which does not change the outcome of the comparison below
+		idx_t pivot_rank = idx;
+		for (idx_t way = 0; way < ways; way++) {
+			if (way != pivot) {
+				preceding[way] = CountPreceding(way, pivot, idx, lo[way], hi[way]);
+				pivot_rank += preceding[way];
+			}
+		}
+		if (pivot_rank < rank) {
+			// The tuple (and everything that precedes it) is part of this partition
+			lo[pivot] = idx + 1;
+			for (idx_t way = 0; way < ways; way++) {
+				if (way != pivot) {
+					lo[way] = MaxValue(lo[way], preceding[way]);
+				}
+			}
+		} else {
+			// The tuple (and everything that follows it) is not part of this partition
+			hi[pivot] = idx;
+			for (idx_t way = 0; way < ways; way++) {
+				if (way != pivot) {
+					hi[way] = MinValue(hi[way], preceding[way]);
+				}
+			}
+		}
+	}
+	for (idx_t way = 0; way < ways; way++) {
+		splits[way] = lo[way];
+	}
+#ifdef DEBUG
+	idx_t split_count = 0;
+	for (idx_t way = 0; way < ways; way++) {
+		split_count += splits[way];
+	}
+	D_ASSERT(split_count == rank);
+#endif
+}
+
+idx_t MergeSorter::CountPreceding(const idx_t way, const idx_t pivot, const idx_t idx, const idx_t lo,
+                                  const idx_t hi) {
+	auto &reader = *way_readers[way];
+	auto &pivot_reader = *way_readers[pivot];
+	// Ties are broken using the reader index
+	const int threshold = way < pivot ? 0 : -1;
+	idx_t l = lo;
+	idx_t r = hi;
+	while (l < r) {
+		const idx_t middle = l + (r - l) / 2;
+		if (CompareAtGlobalIndex(reader, pivot_reader, middle, idx) <= threshold) {
+			l = middle + 1;
+		} else {
+			r = middle;
+		}
+	}
+	return l;
+}
+
+void MergeSorter::MergeKWayPartition() {
+	const idx_t ways = way_readers.size();
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite();
+	// Initialize the tournament tree
+	idx_t remaining = 0;
+	way_remaining.resize(ways);
+	for (idx_t way = 0; way < ways; way++) {
+		way_remaining[way] = way_readers[way]->Remaining();
+		remaining += way_remaining[way];
+	}
+	D_ASSERT(remaining <= state.block_capacity);
+	idx_t leaves = 1;
+	while (leaves < ways) {
+		leaves *= 2;
+	}
+	way_tree.assign(2 * leaves, DConstants::INVALID_INDEX);
+	for (idx_t way = 0; way < ways; way++) {
+		way_tree[leaves + way] = way;
+	}
+	for (idx_t node = leaves - 1; node > 0; node--) {
+		way_tree[node] = KWayWinner(way_tree[2 * node], way_tree[2 * node + 1]);
+	}
+	// Merge loop
+	idx_t sources[STANDARD_VECTOR_SIZE];
+	while (remaining > 0) {
+		const idx_t next = MinValue(remaining, (idx_t)STANDARD_VECTOR_SIZE);
+		ComputeKWayMerge(next, sources);
+		// Actually merge the data (radix, blob, and payload)
+		MergeKWayRadix(next, sources);
+		if (!sort_layout.all_constant) {
+			MergeKWayData(*result->blob_sorting_data, SortedDataType::BLOB, next, sources, true);
+			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
+		}
+		MergeKWayData(*result->payload_data, SortedDataType::PAYLOAD, next, sources, false);
+		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+		remaining -= next;
+	}
+}
+
+idx_t MergeSorter::KWayWinner(const idx_t l_way, const idx_t r_way) {
+	if (l_way == DConstants::INVALID_INDEX || way_remaining[l_way] == 0) {
+		return r_way;
+	}
+	if (r_way == DConstants::INVALID_INDEX || way_remaining[r_way] == 0) {
+		return l_way;
+	}
+	auto &l = *way_readers[l_way];
+	auto &r = *way_readers[r_way];
+	l.PinRadix(l.block_idx);
+	r.PinRadix(r.block_idx);
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l.RadixPtr(), r.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		l.PinData(*l.sb->blob_sorting_data);
+		r.PinData(*r.sb->blob_sorting_data);
+		comp_res = Comparators::CompareTuple(l, r, l.RadixPtr(), r.RadixPtr(), sort_layout, state.external);
+	}
+	// The left subtree holds the readers with the lower indices, ties go to the left
+	return comp_res <= 0 ? l_way : r_way;
+}
+
+void MergeSorter::ComputeKWayMerge(const idx_t &count, idx_t sources[]) {
+	const idx_t ways = way_readers.size();
+	const idx_t leaves = way_tree.size() / 2;
+	// Move the readers to the block that contains their next tuple, and save indices to restore afterwards
+	way_block_idxs.resize(ways);
+	way_entry_idxs.resize(ways);
+	for (idx_t way = 0; way < ways; way++) {
+		auto &reader = *way_readers[way];
+		auto &blocks = reader.sb->radix_sorting_data;
+		while (way_remaining[way] != 0 && reader.entry_idx == blocks[reader.block_idx]->count) {
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		way_block_idxs[way] = reader.block_idx;
+		way_entry_idxs[way] = reader.entry_idx;
+	}
+	// Compute the merge of the next 'count' tuples
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t way = way_tree[1];
+		D_ASSERT(way != DConstants::INVALID_INDEX && way_remaining[way] != 0);
+		sources[i] = way;
+		// Advance the reader
+		auto &reader = *way_readers[way];
+		auto &blocks = reader.sb->radix_sorting_data;
+		reader.entry_idx++;
+		way_remaining[way]--;
+		while (way_remaining[way] != 0 && reader.entry_idx == blocks[reader.block_idx]->count) {
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		// Replay the tournament from the leaf of the reader to the root
+		for (idx_t node = (leaves + way) / 2; node > 0; node /= 2) {
+			way_tree[node] = KWayWinner(way_tree[2 * node], way_tree[2 * node + 1]);
+		}
+	}
+	// Reset block indices
+	for (idx_t way = 0; way < ways; way++) {
+		way_readers[way]->SetIndices(way_block_idxs[way], way_entry_idxs[way]);
+	}
+}
+
+void MergeSorter::MergeKWayRadix(const idx_t &count, const idx_t sources[]) {
+	const idx_t ways = way_readers.size();
+	RowDataBlock &result_block = *result->radix_sorting_data.back();
+	auto result_handle = buffer_manager.Pin(result_block.block);
+	data_ptr_t result_ptr = result_handle.Ptr() + result_block.count * sort_layout.entry_size;
+	D_ASSERT(result_block.count + count <= result_block.capacity);
+	for (idx_t i = 0; i < count; i++) {
+		auto &reader = *way_readers[sources[i]];
+		auto &blocks = reader.sb->radix_sorting_data;
+		// Move to the next block (if needed)
+		while (reader.entry_idx == blocks[reader.block_idx]->count) {
+			// Delete reference to previous block
+			blocks[reader.block_idx]->block = nullptr;
+			// Advance block
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		reader.PinRadix(reader.block_idx);
+		FastMemcpy(result_ptr, reader.RadixPtr(), sort_layout.entry_size);
+		result_ptr += sort_layout.entry_size;
+		reader.entry_idx++;
+	}
+	result_block.count += count;
+	// Reset block indices
+	for (idx_t way = 0; way < ways; way++) {
+		way_readers[way]->SetIndices(way_block_idxs[way], way_entry_idxs[way]);
+	}
+}
+
+void MergeSorter::MergeKWayData(SortedData &result_data, SortedDataType type, const idx_t &count,
+                                const idx_t sources[], bool reset_indices) {
+	const idx_t ways = way_readers.size();
+	const auto &layout = result_data.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	const idx_t heap_pointer_offset = layout.GetHeapOffset();
+	// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
+	const bool copy_heap = !layout.AllConstant() && state.external;
+
+	// Result rows to write to
+	RowDataBlock &result_data_block = *result_data.data_blocks.back();
+	auto result_data_handle = buffer_manager.Pin(result_data_block.block);
+	data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block.count * row_width;
+	D_ASSERT(result_data_block.count + count <= result_data_block.capacity);
+	// Result heap to write to (if needed)
+	RowDataBlock *result_heap_block = nullptr;
+	BufferHandle result_heap_handle;
+	if (copy_heap) {
+		result_heap_block = result_data.heap_blocks.back().get();
+		result_heap_handle = buffer_manager.Pin(result_heap_block->block);
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		auto &reader = *way_readers[sources[i]];
+		auto &source_data = type == SortedDataType::BLOB ? *reader.sb->blob_sorting_data : *reader.sb->payload_data;
+		// Move to new data blocks (if needed)
+		while (reader.entry_idx == source_data.data_blocks[reader.block_idx]->count) {
+			// Delete reference to previous block
+			source_data.data_blocks[reader.block_idx]->block = nullptr;
+			if (copy_heap) {
+				source_data.heap_blocks[reader.block_idx]->block = nullptr;
+			}
+			// Advance block
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		reader.PinData(source_data);
+		FastMemcpy(result_data_ptr, reader.DataPtr(source_data), row_width);
+		if (copy_heap) {
+			// Copy the heap entry of this row, and store its offset in the result row
+			const auto source_heap_ptr = reader.HeapPtr(source_data);
+			const idx_t entry_size = Load<uint32_t>(source_heap_ptr);
+			D_ASSERT(entry_size >= sizeof(uint32_t));
+			// Reallocate result heap block size (if needed)
+			if (result_heap_block->byte_offset + entry_size > result_heap_block->capacity) {
+				idx_t new_capacity =
+				    MaxValue(result_heap_block->capacity * 2, result_heap_block->byte_offset + entry_size);
+				buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
+				result_heap_block->capacity = new_capacity;
+			}
+			Store<idx_t>(result_heap_block->byte_offset, result_data_ptr + heap_pointer_offset);
+			memcpy(result_heap_handle.Ptr() + result_heap_block->byte_offset, source_heap_ptr, entry_size);
+			result_heap_block->byte_offset += entry_size;
+			result_heap_block->count++;
+		}
+		result_data_ptr += row_width;
+		reader.entry_idx++;
+	}
+	result_data_block.count += count;
+	if (reset_indices) {
+		for (idx_t way = 0; way < ways; way++) {
+			way_readers[way]->SetIndices(way_block_idxs[way], way_entry_idxs[way]);
+		}
+	}
+}
+
 } // namespace duckdb
@@ -106,39 +106,43 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	}
 }
 
-//! Textbook LSD radix sort
+//! Textbook LSD radix sort, which collects the counts of all digits in a single pass over the data
 void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                   const idx_t &row_width, const idx_t &sorting_size) {
+	D_ASSERT(sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD);
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
 	bool swap = false;
 
-	idx_t counts[SortConstants::VALUES_PER_RADIX];
+	// Collect counts (re-ordering does not change the counts, so we only need to do this once)
+	idx_t counts[SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD][SortConstants::VALUES_PER_RADIX];
+	memset(counts, 0, sizeof(counts));
+	data_ptr_t offset_ptr = dataptr + col_offset;
+	for (idx_t i = 0; i < count; i++) {
+		for (idx_t r = 0; r < sorting_size; r++) {
+			counts[r][offset_ptr[r]]++;
+		}
+		offset_ptr += row_width;
+	}
 	for (idx_t r = 1; r <= sorting_size; r++) {
-		// Init counts to 0
-		memset(counts, 0, sizeof(counts));
 		// Const some values for convenience
 		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
 		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		const idx_t offset = col_offset + sorting_size - r;
-		// Collect counts
-		data_ptr_t offset_ptr = source_ptr + offset;
-		for (idx_t i = 0; i < count; i++) {
-			counts[*offset_ptr]++;
-			offset_ptr += row_width;
-		}
+		auto &radix_counts = counts[sorting_size - r];
 		// Compute offsets from counts
-		idx_t max_count = counts[0];
+		idx_t max_count = radix_counts[0];
 		for (idx_t val = 1; val < SortConstants::VALUES_PER_RADIX; val++) {
-			max_count = MaxValue<idx_t>(max_count, counts[val]);
-			counts[val] = counts[val] + counts[val - 1];
+			max_count = MaxValue<idx_t>(max_count, radix_counts[val]);
+			radix_counts[val] = radix_counts[val] + radix_counts[val - 1];
 		}
 		if (max_count == count) {
+			// All values are equal for this digit, no need to re-order
 			continue;
 		}
 		// Re-order the data in temporary array
 		data_ptr_t row_ptr = source_ptr + (count - 1) * row_width;
 		for (idx_t i = 0; i < count; i++) {
-			idx_t &radix_offset = --counts[*(row_ptr + offset)];
+			idx_t &radix_offset = --radix_counts[*(row_ptr + offset)];
 			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr -= row_width;
 		}
@@ -235,11 +239,78 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 	}
 }
 
+//! MSD radix sort for keys that contain strings, which sorts partitions using pdqsort once they are small
+//! String keys are long and often share a prefix, so we skip bytes that are equal for all keys, and we only do radix
+//! passes while the partitions are large. This avoids most of the comparisons that pdqsort would otherwise do
+static void RadixSortStrings(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count,
+                             const idx_t &col_offset, const idx_t &row_width, const idx_t &comp_width, idx_t offset) {
+	// Find the first byte in which the keys differ
+	idx_t counts[SortConstants::VALUES_PER_RADIX];
+	for (; offset < comp_width; offset++) {
+		memset(counts, 0, sizeof(counts));
+		data_ptr_t offset_ptr = orig_ptr + col_offset + offset;
+		for (idx_t i = 0; i < count; i++) {
+			counts[*offset_ptr]++;
+			offset_ptr += row_width;
+		}
+		if (counts[*(orig_ptr + col_offset + offset)] != count) {
+			break;
+		}
+	}
+	if (offset == comp_width) {
+		// All keys are equal
+		return;
+	}
+	// Compute locations from counts
+	idx_t locations[SortConstants::VALUES_PER_RADIX];
+	locations[0] = 0;
+	for (idx_t radix = 1; radix < SortConstants::VALUES_PER_RADIX; radix++) {
+		locations[radix] = locations[radix - 1] + counts[radix - 1];
+	}
+	// Re-order the data in temporary array, and move it back
+	data_ptr_t row_ptr = orig_ptr;
+	for (idx_t i = 0; i < count; i++) {
+		const idx_t radix_offset = locations[*(row_ptr + col_offset + offset)]++;
+		FastMemcpy(temp_ptr + radix_offset * row_width, row_ptr, row_width);
+		row_ptr += row_width;
+	}
+	memcpy(orig_ptr, temp_ptr, count * row_width);
+	// Check if done
+	if (offset == comp_width - 1) {
+		return;
+	}
+	// Sort the partitions on the remaining bytes
+	idx_t start = 0;
+	for (idx_t radix = 0; radix < SortConstants::VALUES_PER_RADIX; radix++) {
+		const idx_t radix_count = counts[radix];
+		const data_ptr_t partition_ptr = orig_ptr + start * row_width;
+		if (radix_count > SortConstants::MSD_RADIX_STRING_SORT_THRESHOLD) {
+			RadixSortStrings(partition_ptr, temp_ptr + start * row_width, radix_count, col_offset, row_width,
+			                 comp_width, offset + 1);
+		} else if (radix_count > SortConstants::INSERTION_SORT_THRESHOLD) {
+			auto begin = duckdb_pdqsort::PDQIterator(partition_ptr, row_width);
+			auto end = begin + radix_count;
+			duckdb_pdqsort::PDQConstants constants(row_width, col_offset + offset + 1, comp_width - offset - 1, *end);
+			duckdb_pdqsort::pdqsort_branchless(begin, end, constants);
+		} else if (radix_count > 1) {
+			InsertionSort(partition_ptr, nullptr, radix_count, col_offset, row_width, comp_width, offset + 1, false);
+		}
+		start += radix_count;
+	}
+}
+
 //! Calls different sort functions, depending on the count and sorting sizes
 void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                const idx_t &sorting_size, const SortLayout &sort_layout, bool contains_string) {
 
 	if (contains_string) {
+		if (count > SortConstants::MSD_RADIX_STRING_SORT_THRESHOLD) {
+			const auto block_size = buffer_manager.GetBlockSize();
+			auto temp_block =
+			    buffer_manager.Allocate(MemoryTag::ORDER_BY, MaxValue(count * sort_layout.entry_size, block_size));
+			return RadixSortStrings(dataptr, temp_block.Ptr(), count, col_offset, sort_layout.entry_size,
+			                        sorting_size, 0);
+		}
 		auto begin = duckdb_pdqsort::PDQIterator(dataptr, sort_layout.entry_size);
 		auto end = begin + count;
 		duckdb_pdqsort::PDQConstants constants(sort_layout.entry_size, col_offset, sorting_size, *end);
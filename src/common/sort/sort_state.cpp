@@ -366,7 +366,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_ways(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -437,16 +437,22 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// Merge up to 'merge_ways' blocks at once, so that fewer rounds (and fewer passes over the data) are needed
+	// External merges pin all blocks of a group, therefore we merge fewer blocks at once
+	const auto max_merge_ways =
+	    external ? SortConstants::MAXIMUM_EXTERNAL_MERGE_WAYS : SortConstants::MAXIMUM_MERGE_WAYS;
+	merge_ways = MaxValue<idx_t>(MinValue<idx_t>(sorted_blocks.size(), max_merge_ways), 2);
+	// A single block is left over - keep it on the side
+	if (sorted_blocks.size() % merge_ways == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
+	num_pairs = (sorted_blocks.size() + merge_ways - 1) / merge_ways;
 	l_start = 0;
 	r_start = 0;
+	way_starts.assign(merge_ways, 0);
 	// Allocate room for merge results
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
 		sorted_blocks_temp.emplace_back();
@@ -69,6 +69,10 @@ struct AverageSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.count += count;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		state.count -= count;
+	}
 };
 
 template <class T>
@@ -142,20 +146,34 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.remove = AggregateFunction::UnaryScatterRemove<AvgState<int64_t>, int16_t, IntegerAverageOperation>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.remove =
+		    AggregateFunction::UnaryScatterRemove<AvgState<hugeint_t>, int32_t, IntegerAverageOperationHugeint>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.remove =
+		    AggregateFunction::UnaryScatterRemove<AvgState<hugeint_t>, int64_t, IntegerAverageOperationHugeint>;
+		return function;
 	}
 	case PhysicalType::INT128: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
+		        LogicalType::HUGEINT, LogicalType::DOUBLE);
+		function.remove =
+		    AggregateFunction::UnaryScatterRemove<AvgState<hugeint_t>, hugeint_t, HugeintAverageOperation>;
+		return function;
 	}
 	default:
 		throw InternalException("Unimplemented average aggregate");
@@ -2,6 +2,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 
@@ -81,6 +82,37 @@ struct ApproxDistinctCountState {
 		return idx_t(EstimateCardinality(c));
 	}
 
+	//! Serialized sketches are a format tag and version followed by the registers
+	static constexpr uint8_t SKETCH_TAG = 'H';
+	static constexpr uint8_t SKETCH_VERSION = 1;
+	static constexpr idx_t SKETCH_SIZE = 2 + M;
+
+	string_t Serialize(Vector &result) const {
+		auto blob = StringVector::EmptyString(result, SKETCH_SIZE);
+		auto data = data_ptr_cast(blob.GetDataWriteable());
+		data[0] = SKETCH_TAG;
+		data[1] = SKETCH_VERSION;
+		memcpy(data + 2, k, M);
+		blob.Finalize();
+		return blob;
+	}
+
+	void MergeSerialized(const string_t &blob) {
+		auto data = const_data_ptr_cast(blob.GetData());
+		if (blob.GetSize() != SKETCH_SIZE || data[0] != SKETCH_TAG || data[1] != SKETCH_VERSION) {
+			throw InvalidInputException("Blob is not a valid approx_count_distinct sketch");
+		}
+		for (idx_t i = 0; i < M; ++i) {
+			// a register is at most Q + 1 (see InsertElement), larger values would overflow the counts in Count
+			if (data[2 + i] > Q + 1) {
+				throw InvalidInputException("Blob is not a valid approx_count_distinct sketch");
+			}
+		}
+		for (idx_t i = 0; i < M; ++i) {
+			Update(i, data[2 + i]);
+		}
+	}
+
 	uint8_t k[M];
 };
 
@@ -182,4 +214,55 @@ AggregateFunction ApproxCountDistinctFun::GetFunction() {
 	return GetApproxCountDistinctFunction(LogicalType::ANY);
 }
 
+//===--------------------------------------------------------------------===//
+// Sketches
+//===--------------------------------------------------------------------===//
+struct ApproxCountDistinctSketchFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		target = state.Serialize(finalize_data.result);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		state.MergeSerialized(input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		//	Merging is idempotent
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+AggregateFunction ApproxCountDistinctStateFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::ANY}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, ApproxCountDistinctSketchFunction>,
+	    ApproxCountDistinctUpdateFunction,
+	    AggregateFunction::StateCombine<ApproxDistinctCountState, ApproxCountDistinctSketchFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, ApproxCountDistinctSketchFunction>,
+	    ApproxCountDistinctSimpleUpdateFunction);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunction ApproxCountDistinctMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregate<ApproxDistinctCountState, string_t, string_t,
+	                                         ApproxCountDistinctSketchFunction>(LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void ApproxCountDistinctEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t blob) {
+		ApproxDistinctCountState sketch;
+		sketch.MergeSerialized(blob);
+		return UnsafeNumericCast<int64_t>(sketch.Count());
+	});
+}
+
+ScalarFunction ApproxCountDistinctEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, ApproxCountDistinctEstimateFunction);
+}
+
 } // namespace duckdb
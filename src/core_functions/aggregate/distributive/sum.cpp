@@ -19,6 +19,12 @@ struct SumSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.isset = true;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		//	The removed values still have to be combined, so the state stays set.
+		//	The caller is responsible for resetting states with no values left.
+		state.isset = true;
+	}
 };
 
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
@@ -88,6 +94,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT32: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<int64_t>, int32_t, IntegerSumOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -98,6 +105,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<int64_t>, int64_t, IntegerSumOperation>;
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -158,6 +166,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<int64_t>, int16_t, IntegerSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -166,6 +175,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<hugeint_t>, int32_t, SumToHugeintOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -174,6 +184,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<hugeint_t>, int64_t, SumToHugeintOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -182,6 +193,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterRemove<SumState<hugeint_t>, hugeint_t, HugeintSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -5,6 +5,7 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -405,4 +406,129 @@ AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	return approx_quantile;
 }
 
+//===--------------------------------------------------------------------===//
+// Quantile Sketches
+//===--------------------------------------------------------------------===//
+//	Serialized sketches are a format tag and version, the number of values and the (mean, weight) centroids
+static constexpr uint8_t QUANTILE_SKETCH_TAG = 'T';
+static constexpr uint8_t QUANTILE_SKETCH_VERSION = 1;
+static constexpr idx_t QUANTILE_SKETCH_HEADER = 2 + 2 * sizeof(uint64_t);
+static constexpr idx_t QUANTILE_SKETCH_CENTROID = 2 * sizeof(double);
+
+static string_t SerializeQuantileSketch(ApproxQuantileState &state, Vector &result) {
+	D_ASSERT(state.h);
+	state.h->compress();
+	const auto &centroids = state.h->processed();
+	auto blob = StringVector::EmptyString(result, QUANTILE_SKETCH_HEADER + centroids.size() * QUANTILE_SKETCH_CENTROID);
+	auto data = data_ptr_cast(blob.GetDataWriteable());
+	data[0] = QUANTILE_SKETCH_TAG;
+	data[1] = QUANTILE_SKETCH_VERSION;
+	Store<uint64_t>(state.pos, data + 2);
+	Store<uint64_t>(centroids.size(), data + 2 + sizeof(uint64_t));
+	data += QUANTILE_SKETCH_HEADER;
+	for (const auto &centroid : centroids) {
+		Store<double>(centroid.mean(), data);
+		Store<double>(centroid.weight(), data + sizeof(double));
+		data += QUANTILE_SKETCH_CENTROID;
+	}
+	blob.Finalize();
+	return blob;
+}
+
+static void MergeQuantileSketch(const string_t &blob, ApproxQuantileState &state) {
+	auto data = const_data_ptr_cast(blob.GetData());
+	const auto size = blob.GetSize();
+	if (size < QUANTILE_SKETCH_HEADER || data[0] != QUANTILE_SKETCH_TAG || data[1] != QUANTILE_SKETCH_VERSION) {
+		throw InvalidInputException("Blob is not a valid quantile sketch");
+	}
+	const auto pos = Load<uint64_t>(data + 2);
+	const auto count = Load<uint64_t>(data + 2 + sizeof(uint64_t));
+	// compare against the centroid count computed from the size, as the size computed from the count can overflow
+	const auto centroid_bytes = size - QUANTILE_SKETCH_HEADER;
+	if (centroid_bytes % QUANTILE_SKETCH_CENTROID != 0 || count != centroid_bytes / QUANTILE_SKETCH_CENTROID) {
+		throw InvalidInputException("Blob is not a valid quantile sketch");
+	}
+	data += QUANTILE_SKETCH_HEADER;
+	for (idx_t i = 0; i < count; ++i) {
+		const auto mean = Load<double>(data + i * QUANTILE_SKETCH_CENTROID);
+		const auto weight = Load<double>(data + i * QUANTILE_SKETCH_CENTROID + sizeof(double));
+		if (!Value::IsFinite(mean) || !Value::IsFinite(weight) || weight <= 0) {
+			throw InvalidInputException("Blob is not a valid quantile sketch");
+		}
+	}
+	if (!count) {
+		return;
+	}
+	if (!state.h) {
+		state.h = new duckdb_tdigest::TDigest(100);
+	}
+	for (idx_t i = 0; i < count; ++i) {
+		state.h->add(Load<double>(data), Load<double>(data + sizeof(double)));
+		data += QUANTILE_SKETCH_CENTROID;
+	}
+	state.pos += pos;
+}
+
+struct QuantileSketchOperation : public ApproxQuantileOperation {
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(STATE &state, TARGET_TYPE &target, AggregateFinalizeData &finalize_data) {
+		if (state.pos == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		target = SerializeQuantileSketch(state, finalize_data.result);
+	}
+};
+
+struct QuantileSketchMergeOperation : public QuantileSketchOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		MergeQuantileSketch(input, state);
+	}
+};
+
+AggregateFunction QuantileSketchFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t, QuantileSketchOperation>(
+	    LogicalType::DOUBLE, LogicalType::BLOB);
+}
+
+AggregateFunction QuantileSketchMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t,
+	                                                   QuantileSketchMergeOperation>(LogicalType::BLOB,
+	                                                                                 LogicalType::BLOB);
+}
+
+static void QuantileSketchEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto estimate = [&](string_t blob, double quantile, ValidityMask &mask, idx_t idx) {
+		if (quantile < 0 || quantile > 1) {
+			throw InvalidInputException("quantile_sketch_estimate can only take quantiles in range [0, 1]");
+		}
+		ApproxQuantileState sketch;
+		ApproxQuantileOperation::Initialize(sketch);
+		MergeQuantileSketch(blob, sketch);
+		if (!sketch.h) {
+			mask.SetInvalid(idx);
+			return 0.0;
+		}
+		unique_ptr<duckdb_tdigest::TDigest> digest(sketch.h);
+		digest->compress();
+		return digest->quantile(quantile);
+	};
+	BinaryExecutor::ExecuteWithNulls<string_t, double, double>(args.data[0], args.data[1], result, args.size(),
+	                                                           estimate);
+}
+
+ScalarFunction QuantileSketchEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE,
+	                      QuantileSketchEstimateFunction);
+}
+
 } // namespace duckdb
@@ -204,6 +204,7 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
 		D_ASSERT(bind_data.quantiles.size() == 1);
 		Interpolator<DISCRETE> interp(bind_data.quantiles[0], state.v.size(), bind_data.desc);
+		QuantileNarrow::Operation(state.v.data(), interp);
 		target = interp.template Operation<typename STATE::InputType, T>(state.v.data(), finalize_data.result);
 	}
 
@@ -260,6 +261,7 @@ struct QuantileScalarFallback : QuantileOperation {
 		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
 		D_ASSERT(bind_data.quantiles.size() == 1);
 		Interpolator<true> interp(bind_data.quantiles[0], state.v.size(), bind_data.desc);
+		QuantileNarrow::Operation(state.v.data(), interp);
 		auto interpolation_result = interp.InterpolateInternal<string_t>(state.v.data());
 		CreateSortKeyHelpers::DecodeSortKey(interpolation_result, finalize_data.result, finalize_data.result_idx,
 		                                    OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
@@ -296,6 +298,7 @@ struct QuantileListOperation : QuantileOperation {
 			const auto &quantile = bind_data.quantiles[q];
 			Interpolator<DISCRETE> interp(quantile, state.v.size(), bind_data.desc);
 			interp.begin = lower;
+			QuantileNarrow::Operation(v_t, interp);
 			rdata[ridx + q] = interp.template Operation<typename STATE::InputType, CHILD_TYPE>(v_t, result);
 			lower = interp.FRN;
 		}
@@ -361,6 +364,7 @@ struct QuantileListFallback : QuantileOperation {
 			const auto &quantile = bind_data.quantiles[q];
 			Interpolator<true> interp(quantile, state.v.size(), bind_data.desc);
 			interp.begin = lower;
+			QuantileNarrow::Operation(state.v.data(), interp);
 			auto interpolation_result = interp.InterpolateInternal<string_t>(state.v.data());
 			CreateSortKeyHelpers::DecodeSortKey(interpolation_result, result, ridx + q,
 			                                    OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
@@ -67,6 +67,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION(AliasFun),
 	DUCKDB_SCALAR_FUNCTION_ALIAS(ApplyFun),
 	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctFun),
+	DUCKDB_SCALAR_FUNCTION(ApproxCountDistinctEstimateFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctStateFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ApproxQuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION(ApproxTopKFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ArgMaxFun),
@@ -290,6 +293,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_AGGREGATE_FUNCTION_SET_ALIAS(QuantileFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileContFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(QuantileDiscFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchFun),
+	DUCKDB_SCALAR_FUNCTION(QuantileSketchEstimateFun),
+	DUCKDB_AGGREGATE_FUNCTION(QuantileSketchMergeFun),
 	DUCKDB_SCALAR_FUNCTION_SET(QuarterFun),
 	DUCKDB_SCALAR_FUNCTION(RadiansFun),
 	DUCKDB_SCALAR_FUNCTION(RandomFun),
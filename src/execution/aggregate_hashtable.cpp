@@ -32,7 +32,7 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 GroupedAggregateHashTable::AggregateHTAppendState::AggregateHTAppendState()
     : ht_offsets(LogicalType::UBIGINT), hash_salts(LogicalType::HASH), group_compare_vector(STANDARD_VECTOR_SIZE),
       no_match_vector(STANDARD_VECTOR_SIZE), empty_vector(STANDARD_VECTOR_SIZE), new_groups(STANDARD_VECTOR_SIZE),
-      addresses(LogicalType::POINTER) {
+      addresses(LogicalType::POINTER), tile_addresses(LogicalType::POINTER) {
 }
 
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
@@ -41,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), sink_count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -134,6 +135,10 @@ idx_t GroupedAggregateHashTable::ResizeThreshold() const {
 	return LossyNumericCast<idx_t>(static_cast<double>(Capacity()) / LOAD_FACTOR);
 }
 
+idx_t GroupedAggregateHashTable::GetSinkCount() const {
+	return sink_count;
+}
+
 idx_t GroupedAggregateHashTable::ApplyBitMask(hash_t hash) const {
 	return hash & bitmask;
 }
@@ -162,6 +167,18 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::ResetSinkCount() {
+	sink_count = 0;
+}
+
+void GroupedAggregateHashTable::SkipLookups() {
+	skip_lookups = true;
+}
+
+bool GroupedAggregateHashTable::SkipsLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -246,10 +263,87 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	}
 #endif
 
+	sink_count += groups.size();
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
+	const auto tile_size = GetUpdateTileSize(payload, filter);
+	if (tile_size == 0) {
+		UpdateAggregates(payload, state.addresses, filter);
+	} else {
+		// Update all aggregates for a tile of rows before moving on to the next tile,
+		// so the states of the tile are still cached when the next aggregate updates them
+		auto &tile_payload = state.tile_payload;
+		if (tile_payload.ColumnCount() != payload.ColumnCount() || tile_payload.GetTypes() != payload.GetTypes()) {
+			tile_payload.Destroy();
+			tile_payload.InitializeEmpty(payload.GetTypes());
+		}
+		const auto count = payload.size();
+		for (idx_t tile_start = 0; tile_start < count; tile_start += tile_size) {
+			const auto tile_end = MinValue<idx_t>(tile_start + tile_size, count);
+			// The slices reference the original buffers, so the addresses are advanced in place
+			state.tile_addresses.Slice(state.addresses, tile_start, tile_end);
+			for (idx_t col_idx = 0; col_idx < payload.ColumnCount(); col_idx++) {
+				tile_payload.data[col_idx].Slice(payload.data[col_idx], tile_start, tile_end);
+			}
+			tile_payload.SetCardinality(tile_end - tile_start);
+			UpdateAggregates(tile_payload, state.tile_addresses, filter);
+		}
+	}
+
+	Verify();
+	return new_group_count;
+}
+
+idx_t GroupedAggregateHashTable::GetUpdateTileSize(DataChunk &payload, const unsafe_vector<idx_t> &filter) const {
+	// Tiling only pays off if several aggregates update the same rows
+	static constexpr idx_t MIN_TILED_AGGREGATES = 2;
+	// Aim to keep the rows of a tile in the L1 cache
+	static constexpr idx_t TILE_BYTES = 32768;
+	if (filter.size() < MIN_TILED_AGGREGATES) {
+		return 0;
+	}
+
+	// Aggregates with a FILTER clause slice the payload themselves
+	auto &aggregates = layout.GetAggregates();
+	for (const auto &aggr_idx : filter) {
+		auto &aggr = aggregates[aggr_idx];
+		if (aggr.aggr_type != AggregateType::DISTINCT && aggr.filter) {
+			return 0;
+		}
+	}
+
+	// Only flat and constant vectors can be sliced without copying
+	for (auto &vector : payload.data) {
+		switch (vector.GetVectorType()) {
+		case VectorType::FLAT_VECTOR:
+		case VectorType::CONSTANT_VECTOR:
+			break;
+		default:
+			return 0;
+		}
+		switch (vector.GetType().InternalType()) {
+		case PhysicalType::STRUCT:
+		case PhysicalType::ARRAY:
+			return 0;
+		default:
+			break;
+		}
+	}
+
+	// Multiples of the validity entry size keep the validity masks aligned
+	auto tile_size = TILE_BYTES / MaxValue<idx_t>(layout.GetRowWidth(), 1);
+	tile_size -= tile_size % ValidityMask::BITS_PER_VALUE;
+	tile_size = MaxValue<idx_t>(tile_size, ValidityMask::BITS_PER_VALUE);
+	if (tile_size >= payload.size()) {
+		return 0;
+	}
+	return tile_size;
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, Vector &addresses,
+                                                 const unsafe_vector<idx_t> &filter) {
 	auto &aggregates = layout.GetAggregates();
 	idx_t filter_idx = 0;
 	idx_t payload_idx = 0;
@@ -259,26 +353,23 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		if (filter_idx >= filter.size() || i < filter[filter_idx]) {
 			// Skip all the aggregates that are not in the filter
 			payload_idx += aggr.child_count;
-			VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
+			VectorOperations::AddInPlace(addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
 			continue;
 		}
 		D_ASSERT(i == filter[filter_idx]);
 
 		if (aggr.aggr_type != AggregateType::DISTINCT && aggr.filter) {
-			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(i), aggr, state.addresses, payload,
+			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(i), aggr, addresses, payload,
 			                                    payload_idx);
 		} else {
-			RowOperations::UpdateStates(row_state, aggr, state.addresses, payload, payload_idx, payload.size());
+			RowOperations::UpdateStates(row_state, aggr, addresses, payload, payload_idx, payload.size());
 		}
 
 		// Move to the next aggregate
 		payload_idx += aggr.child_count;
-		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
+		VectorOperations::AddInPlace(addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
 		filter_idx++;
 	}
-
-	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -313,8 +404,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
-	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	// Need to fit the entire vector, and resize at threshold (the pointer table is not used if we skip lookups)
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -359,6 +450,23 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every tuple becomes a new group without probing the pointer table
+		const auto group_count = groups.size();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, *sel_vector, group_count);
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+		                                group_count);
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < group_count; i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		count += group_count;
+		return group_count;
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
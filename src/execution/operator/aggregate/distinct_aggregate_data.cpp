@@ -45,8 +45,8 @@ DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data
 			continue;
 		}
 		D_ASSERT(data.info.table_map.count(i));
-		idx_t table_idx = data.info.table_map.at(i);
-		if (data.radix_tables[table_idx] == nullptr) {
+		idx_t table_idx = data.IsShared() ? 0 : data.info.table_map.at(i);
+		if (data.radix_tables[table_idx] == nullptr || radix_states[table_idx]) {
 			//! This table is unused because the aggregate shares its data with another
 			continue;
 		}
@@ -56,8 +56,9 @@ DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data
 		radix_states[table_idx] = radix_table.GetGlobalSinkState(client);
 
 		// Fill the chunk_types (group_by + children)
+		auto &table_data = data.IsShared() ? *data.shared_data : *data.grouped_aggregate_data[table_idx];
 		vector<LogicalType> chunk_types;
-		for (auto &group_type : data.grouped_aggregate_data[table_idx]->group_types) {
+		for (auto &group_type : table_data.group_types) {
 			chunk_types.push_back(group_type);
 		}
 
@@ -78,16 +79,18 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 	grouped_aggregate_data.resize(info.table_count);
 	radix_tables.resize(info.table_count);
 	grouping_sets.resize(info.table_count);
+	table_aggregates.resize(info.table_count, DConstants::INVALID_INDEX);
 
 	for (auto &i : info.indices) {
 		auto &aggregate = info.aggregates[i]->Cast<BoundAggregateExpression>();
 
 		D_ASSERT(info.table_map.count(i));
 		idx_t table_idx = info.table_map.at(i);
-		if (radix_tables[table_idx] != nullptr) {
+		if (grouped_aggregate_data[table_idx] != nullptr) {
 			//! This aggregate shares a table with another aggregate, and the table is already initialized
 			continue;
 		}
+		table_aggregates[table_idx] = i;
 		// The grouping set contains the indices of the chunk that correspond to the data vector
 		// that will be used to figure out in which bucket the payload should be put
 		auto &grouping_set = grouping_sets[table_idx];
@@ -102,15 +105,128 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 		// Create the hashtable for the aggregate
 		grouped_aggregate_data[table_idx] = make_uniq<GroupedAggregateData>();
 		grouped_aggregate_data[table_idx]->InitializeDistinct(info.aggregates[i], group_expressions);
+	}
+
+	InitializeShared(groups, group_expressions);
+	if (IsShared()) {
+		radix_tables.resize(1);
+		radix_tables[0] = make_uniq<RadixPartitionedHashTable>(shared_grouping_set, *shared_data);
+		return;
+	}
+	for (idx_t table_idx = 0; table_idx < info.table_count; table_idx++) {
 		radix_tables[table_idx] =
-		    make_uniq<RadixPartitionedHashTable>(grouping_set, *grouped_aggregate_data[table_idx]);
+		    make_uniq<RadixPartitionedHashTable>(grouping_sets[table_idx], *grouped_aggregate_data[table_idx]);
+	}
+}
 
-		// Fill the chunk_types (only contains the payload of the distinct aggregates)
-		vector<LogicalType> chunk_types;
-		for (auto &child_p : aggregate.children) {
-			chunk_types.push_back(child_p->return_type);
+void DistinctAggregateData::InitializeShared(const GroupingSet &groups,
+                                             const vector<unique_ptr<Expression>> *group_expressions) {
+	if (info.table_count < 2 || info.table_count > NumericLimits<uint8_t>::Maximum()) {
+		return;
+	}
+
+	// Assign the arguments of every table to columns of the shared table, reusing columns of the same type
+	vector<vector<idx_t>> columns(info.table_count);
+	vector<LogicalType> argument_types;
+	idx_t argument_count = 0;
+	for (idx_t table_idx = 0; table_idx < info.table_count; table_idx++) {
+		auto &aggregate = info.aggregates[table_aggregates[table_idx]]->Cast<BoundAggregateExpression>();
+		vector<bool> used(argument_types.size(), false);
+		for (auto &child : aggregate.children) {
+			idx_t column_idx = 0;
+			while (column_idx < argument_types.size() &&
+			       (used[column_idx] || argument_types[column_idx] != child->return_type)) {
+				column_idx++;
+			}
+			if (column_idx == argument_types.size()) {
+				argument_types.push_back(child->return_type);
+				used.push_back(false);
+			}
+			used[column_idx] = true;
+			columns[table_idx].push_back(column_idx);
+			argument_count++;
+		}
+	}
+	if (argument_types.size() == argument_count) {
+		// No columns are shared, so the shared table would only be wider than the separate ones
+		return;
+	}
+
+	// The shared table groups on (groups, table index, arguments), which are the columns of the shared chunk
+	vector<unique_ptr<Expression>> shared_group_expressions;
+	if (group_expressions) {
+		for (auto &group : *group_expressions) {
+			shared_groups.push_back(group->Cast<BoundReferenceExpression>().index);
+			shared_group_expressions.push_back(
+			    make_uniq<BoundReferenceExpression>(group->return_type, shared_group_expressions.size()));
 		}
 	}
+	for (auto &group : groups) {
+		shared_grouping_set.insert(group);
+	}
+	shared_grouping_set.insert(shared_group_expressions.size());
+	shared_group_expressions.push_back(
+	    make_uniq<BoundReferenceExpression>(LogicalType::UTINYINT, shared_group_expressions.size()));
+	for (auto &type : argument_types) {
+		shared_grouping_set.insert(shared_group_expressions.size());
+		shared_group_expressions.push_back(make_uniq<BoundReferenceExpression>(type, shared_group_expressions.size()));
+	}
+	shared_data = make_uniq<GroupedAggregateData>();
+	shared_data->InitializeGroupby(std::move(shared_group_expressions), {}, {});
+	shared_argument_types = std::move(argument_types);
+	shared_columns = std::move(columns);
+}
+
+bool DistinctAggregateData::IsShared() const {
+	return shared_data != nullptr;
+}
+
+void DistinctAggregateData::PopulateSharedChunk(idx_t table_idx, DataChunk &input, DataChunk &shared_chunk) const {
+	D_ASSERT(IsShared());
+	idx_t column_idx = 0;
+	for (auto &group : shared_groups) {
+		shared_chunk.data[column_idx++].Reference(input.data[group]);
+	}
+	shared_chunk.data[column_idx++].Reference(Value::UTINYINT(NumericCast<uint8_t>(table_idx)));
+
+	// The arguments of the other tables are NULL
+	for (idx_t argument_idx = 0; argument_idx < shared_argument_types.size(); argument_idx++) {
+		shared_chunk.data[column_idx + argument_idx].Reference(Value(shared_argument_types[argument_idx]));
+	}
+	auto &aggregate = info.aggregates[table_aggregates[table_idx]]->Cast<BoundAggregateExpression>();
+	auto &columns = shared_columns[table_idx];
+	for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+		auto &bound_ref = aggregate.children[child_idx]->Cast<BoundReferenceExpression>();
+		shared_chunk.data[column_idx + columns[child_idx]].Reference(input.data[bound_ref.index]);
+	}
+	shared_chunk.SetCardinality(input);
+}
+
+void DistinctAggregateData::SliceSharedOutput(idx_t table_idx, DataChunk &shared_output, DataChunk &table_output,
+                                              SelectionVector &sel) const {
+	D_ASSERT(IsShared());
+	const auto group_count = shared_groups.size();
+
+	// Select the rows of the table
+	UnifiedVectorFormat table_format;
+	shared_output.data[group_count].ToUnifiedFormat(shared_output.size(), table_format);
+	auto table_indices = UnifiedVectorFormat::GetData<uint8_t>(table_format);
+	idx_t count = 0;
+	for (idx_t i = 0; i < shared_output.size(); i++) {
+		if (table_indices[table_format.sel->get_index(i)] == table_idx) {
+			sel.set_index(count++, i);
+		}
+	}
+
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		table_output.data[group_idx].Slice(shared_output.data[group_idx], sel, count);
+	}
+	auto &columns = shared_columns[table_idx];
+	for (idx_t child_idx = 0; child_idx < columns.size(); child_idx++) {
+		table_output.data[group_count + child_idx].Slice(shared_output.data[group_count + 1 + columns[child_idx]],
+		                                                 sel, count);
+	}
+	table_output.SetCardinality(count);
 }
 
 using aggr_ref_t = reference<BoundAggregateExpression>;
@@ -7,6 +7,7 @@
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/operator/aggregate/distinct_aggregate_data.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/parallel/pipeline.hpp"
@@ -56,9 +57,9 @@ HashAggregateGroupingLocalState::HashAggregateGroupingLocalState(const PhysicalH
 	auto &table_map = op.distinct_collection_info->table_map;
 
 	for (auto &idx : distinct_indices) {
-		idx_t table_idx = table_map[idx];
+		idx_t table_idx = distinct_data.IsShared() ? 0 : table_map[idx];
 		auto &radix_table = distinct_data.radix_tables[table_idx];
-		if (radix_table == nullptr) {
+		if (radix_table == nullptr || distinct_states[table_idx]) {
 			// This aggregate has identical input as another aggregate, so no table is created for it
 			continue;
 		}
@@ -278,17 +279,24 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 
 		D_ASSERT(distinct_info.table_map.count(idx));
 		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
+		if (distinct_data->table_aggregates[table_idx] != idx) {
+			// The input of this aggregate is sunk by the first aggregate that uses the table
 			continue;
 		}
-		D_ASSERT(distinct_data->radix_tables[table_idx]);
-		auto &radix_table = *distinct_data->radix_tables[table_idx];
-		auto &radix_global_sink = *distinct_state->radix_states[table_idx];
-		auto &radix_local_sink = *grouping_lstate.distinct_states[table_idx];
+		const auto radix_idx = distinct_data->IsShared() ? 0 : table_idx;
+		if (!distinct_data->radix_tables[radix_idx]) {
+			continue;
+		}
+		D_ASSERT(distinct_data->radix_tables[radix_idx]);
+		auto &radix_table = *distinct_data->radix_tables[radix_idx];
+		auto &radix_global_sink = *distinct_state->radix_states[radix_idx];
+		auto &radix_local_sink = *grouping_lstate.distinct_states[radix_idx];
 
 		InterruptState interrupt_state;
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, interrupt_state};
 
+		DataChunk filtered_input;
+		reference<DataChunk> distinct_input(chunk);
 		if (aggregate.filter) {
 			DataChunk filter_chunk;
 			auto &filtered_data = sink.filter_set.GetFilterData(idx);
@@ -313,7 +321,6 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 
 			// Because the 'input' chunk needs to be re-used after this, we need to create
 			// a duplicate of it, that we can apply the filter to
-			DataChunk filtered_input;
 			filtered_input.InitializeEmpty(chunk.GetTypes());
 
 			for (idx_t group_idx = 0; group_idx < grouped_aggregate_data.groups.size(); group_idx++) {
@@ -329,10 +336,16 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 			}
 			filtered_input.Slice(sel_vec, count);
 			filtered_input.SetCardinality(count);
+			distinct_input = filtered_input;
+		}
 
-			radix_table.Sink(context, filtered_input, sink_input, empty_chunk, empty_filter);
+		if (distinct_data->IsShared()) {
+			DataChunk shared_chunk;
+			shared_chunk.InitializeEmpty(distinct_data->shared_data->group_types);
+			distinct_data->PopulateSharedChunk(table_idx, distinct_input.get(), shared_chunk);
+			radix_table.Sink(context, shared_chunk, sink_input, empty_chunk, empty_filter);
 		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, empty_filter);
+			radix_table.Sink(context, distinct_input.get(), sink_input, empty_chunk, empty_filter);
 		}
 	}
 }
@@ -547,6 +560,9 @@ public:
 
 private:
 	TaskExecutionResult AggregateDistinctGrouping(const idx_t grouping_idx);
+	TaskExecutionResult AggregateSharedDistinctGrouping(const idx_t grouping_idx, ExecutionContext &execution_context,
+	                                                    OperatorSinkInput &sink_input, DataChunk &group_chunk,
+	                                                    DataChunk &aggregate_input_chunk);
 
 private:
 	Pipeline &pipeline;
@@ -584,6 +600,14 @@ idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
 		auto &distinct_data = *grouping.distinct_data;
 
 		vector<unique_ptr<GlobalSourceState>> aggregate_sources;
+		if (distinct_data.IsShared()) {
+			// All distinct aggregates are computed from a single scan of the shared table
+			auto &radix_table_p = distinct_data.radix_tables[0];
+			n_tasks += radix_table_p->MaxThreads(*distinct_state.radix_states[0]);
+			aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+			global_source_states.push_back(std::move(aggregate_sources));
+			continue;
+		}
 		aggregate_sources.reserve(aggregates.size());
 		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
 			auto &aggregate = aggregates[agg_idx];
@@ -628,6 +652,32 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::ExecuteTask(TaskExecution
 	return TaskExecutionResult::TASK_FINISHED;
 }
 
+//! Sink the distinct values of a table (in the layout of its output) into the main ht, for the given aggregate
+static void SinkDistinctOutput(ExecutionContext &context, const PhysicalHashAggregate &op,
+                               const HashAggregateGroupingData &grouping_data, idx_t table_idx, idx_t agg_idx,
+                               idx_t payload_idx, DataChunk &output_chunk, DataChunk &group_chunk,
+                               DataChunk &aggregate_input_chunk, OperatorSinkInput &sink_input) {
+	group_chunk.Reset();
+	aggregate_input_chunk.Reset();
+
+	const idx_t group_by_size = op.grouped_aggregate_data.groups.size();
+	auto &grouped_aggregate_data = *grouping_data.distinct_data->grouped_aggregate_data[table_idx];
+	for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+		auto &group = grouped_aggregate_data.groups[group_idx];
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
+	}
+	group_chunk.SetCardinality(output_chunk);
+
+	for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
+		aggregate_input_chunk.data[payload_idx + child_idx].Reference(output_chunk.data[group_by_size + child_idx]);
+	}
+	aggregate_input_chunk.SetCardinality(output_chunk);
+
+	// Sink it into the main ht
+	grouping_data.table_data.Sink(context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
+}
+
 TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping(const idx_t grouping_idx) {
 	D_ASSERT(op.distinct_collection_info);
 	auto &info = *op.distinct_collection_info;
@@ -658,13 +708,21 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 		group_chunk.Initialize(executor.context, op.input_group_types);
 	}
 
-	const idx_t group_by_size = op.grouped_aggregate_data.groups.size();
-
 	DataChunk aggregate_input_chunk;
 	if (!gstate.payload_types.empty()) {
 		aggregate_input_chunk.Initialize(executor.context, gstate.payload_types);
 	}
 
+	if (distinct_data.IsShared()) {
+		auto res = AggregateSharedDistinctGrouping(grouping_idx, execution_context, sink_input, group_chunk,
+		                                           aggregate_input_chunk);
+		if (res == TaskExecutionResult::TASK_BLOCKED) {
+			return res;
+		}
+		grouping_data.table_data.Combine(execution_context, global_sink_state, *local_sink_state);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
 	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
 	auto &agg_idx = aggregation_idx;
@@ -701,8 +759,6 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 		// Fetch all the data from the aggregate ht, and Sink it into the main ht
 		while (true) {
 			output_chunk.Reset();
-			group_chunk.Reset();
-			aggregate_input_chunk.Reset();
 
 			auto res = radix_table->GetData(execution_context, output_chunk, sink, source_input);
 			if (res == SourceResultType::FINISHED) {
@@ -713,22 +769,8 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 				return TaskExecutionResult::TASK_BLOCKED;
 			}
 
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
-				auto &group = grouped_aggregate_data.groups[group_idx];
-				auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
-				group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
-			}
-			group_chunk.SetCardinality(output_chunk);
-
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
-			}
-			aggregate_input_chunk.SetCardinality(output_chunk);
-
-			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
+			SinkDistinctOutput(execution_context, op, grouping_data, table_idx, agg_idx, payload_idx, output_chunk,
+			                   group_chunk, aggregate_input_chunk, sink_input);
 		}
 		blocked = false;
 	}
@@ -736,6 +778,63 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 	return TaskExecutionResult::TASK_FINISHED;
 }
 
+TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateSharedDistinctGrouping(
+    const idx_t grouping_idx, ExecutionContext &execution_context, OperatorSinkInput &sink_input,
+    DataChunk &group_chunk, DataChunk &aggregate_input_chunk) {
+	auto &grouping_data = op.groupings[grouping_idx];
+	auto &distinct_state = *gstate.grouping_states[grouping_idx].distinct_state;
+	auto &distinct_data = *grouping_data.distinct_data;
+	auto &aggregates = op.grouped_aggregate_data.aggregates;
+	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
+
+	auto &radix_table = distinct_data.radix_tables[0];
+	auto &sink = *distinct_state.radix_states[0];
+	if (!blocked) {
+		radix_table_lstate = radix_table->GetLocalSourceState(execution_context);
+	}
+	InterruptState interrupt_state(shared_from_this());
+	OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][0], *radix_table_lstate,
+	                                  interrupt_state};
+
+	DataChunk output_chunk;
+	output_chunk.Initialize(executor.context, distinct_state.distinct_output_chunks[0]->GetTypes());
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+
+	// Fetch all the data from the shared ht, and Sink the rows of every table into the main ht
+	while (true) {
+		output_chunk.Reset();
+		auto res = radix_table->GetData(execution_context, output_chunk, sink, source_input);
+		if (res == SourceResultType::FINISHED) {
+			D_ASSERT(output_chunk.size() == 0);
+			break;
+		} else if (res == SourceResultType::BLOCKED) {
+			blocked = true;
+			return TaskExecutionResult::TASK_BLOCKED;
+		}
+
+		idx_t payload_offset = 0;
+		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
+			auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+			const auto aggregate_payload_idx = payload_offset;
+			payload_offset += aggregate.children.size();
+			if (!distinct_data.IsDistinct(agg_idx)) {
+				continue;
+			}
+			const auto table_idx = distinct_data.info.table_map.at(agg_idx);
+			DataChunk table_chunk;
+			table_chunk.InitializeEmpty(distinct_data.grouped_aggregate_data[table_idx]->group_types);
+			distinct_data.SliceSharedOutput(table_idx, output_chunk, table_chunk, sel);
+			if (table_chunk.size() == 0) {
+				continue;
+			}
+			SinkDistinctOutput(execution_context, op, grouping_data, table_idx, agg_idx, aggregate_payload_idx,
+			                   table_chunk, group_chunk, aggregate_input_chunk, sink_input);
+		}
+	}
+	blocked = false;
+	return TaskExecutionResult::TASK_FINISHED;
+}
+
 SinkFinalizeType PhysicalHashAggregate::FinalizeDistinct(Pipeline &pipeline, Event &event, ClientContext &context,
                                                          GlobalSinkState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<HashAggregateGlobalSinkState>();
@@ -771,10 +870,19 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 		return FinalizeDistinct(pipeline, event, context, gstate_p);
 	}
 
+	idx_t skipped_lookups = 0;
 	for (idx_t i = 0; i < groupings.size(); i++) {
 		auto &grouping = groupings[i];
 		auto &grouping_gstate = gstate.grouping_states[i];
 		grouping.table_data.Finalize(context, *grouping_gstate.table_state);
+		if (RadixPartitionedHashTable::SkippedLookups(*grouping_gstate.table_state)) {
+			skipped_lookups++;
+		}
+	}
+	if (skipped_lookups != 0) {
+		// Report that the thread-local pre-aggregation was bypassed in EXPLAIN ANALYZE
+		auto bypassed = StringUtil::Format("Bypassed (%llu/%llu grouping sets)", skipped_lookups, groupings.size());
+		QueryProfiler::Get(context).AddToExtraInfo(*this, "Partial Aggregation", bypassed);
 	}
 	return SinkFinalizeType::READY;
 }
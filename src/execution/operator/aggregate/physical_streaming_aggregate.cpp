@@ -0,0 +1,560 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(ClientContext &context, vector<LogicalType> types_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
+
+	vector<BoundAggregateExpression *> bindings;
+	vector<LogicalType> payload_types_filters;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		D_ASSERT(expr->IsAggregate());
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+
+		D_ASSERT(!aggr.IsDistinct());
+		D_ASSERT(aggr.function.combine);
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+		if (aggr.filter) {
+			payload_types_filters.push_back(aggr.filter->return_type);
+		}
+	}
+	for (const auto &pay_filters : payload_types_filters) {
+		payload_types.push_back(pay_filters);
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+
+	// filter_indexes must be pre-built, not lazily instantiated
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		aggregate_input_idx += aggr.children.size();
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto &bound_ref_expr = aggr.filter->Cast<BoundReferenceExpression>();
+			auto it = filter_indexes.find(aggr.filter.get());
+			if (it == filter_indexes.end()) {
+				filter_indexes[aggr.filter.get()] = bound_ref_expr.index;
+				bound_ref_expr.index = aggregate_input_idx++;
+			} else {
+				++aggregate_input_idx;
+			}
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Order Properties
+//===--------------------------------------------------------------------===//
+//! A column of an operator's output that the output is sorted on
+struct SortedColumn {
+	SortedColumn(idx_t index, bool injective, OrderType type, OrderByNullType null_order)
+	    : index(index), injective(injective), type(type), null_order(null_order) {
+	}
+
+	//! The index of the column
+	idx_t index;
+	//! Whether equal values in this column correspond to equal values of the sort key. If not, the column is only
+	//! non-decreasing (e.g., date_trunc of a sort key), and the output is not sorted on any columns after it
+	bool injective;
+	//! The sort direction
+	OrderType type;
+	//! The position of NULL values
+	OrderByNullType null_order;
+};
+
+static bool IsOrderPreservingFunction(const BoundFunctionExpression &function, idx_t &argument_idx, bool &injective) {
+	auto &name = function.function.name;
+	if (StringUtil::StartsWith(name, "__internal_decompress")) {
+		// Decompression functions of compressed materialization are injective and order-preserving
+		argument_idx = 0;
+		injective = true;
+	} else if (name == "date_trunc" || name == "datetrunc" || name == "time_bucket") {
+		// Truncating a date/timestamp is non-decreasing
+		argument_idx = 1;
+		injective = false;
+	} else {
+		return false;
+	}
+	if (argument_idx >= function.children.size()) {
+		return false;
+	}
+	auto &argument_type = function.children[argument_idx]->return_type;
+	if (!injective && argument_type.id() != LogicalTypeId::DATE && argument_type.id() != LogicalTypeId::TIMESTAMP) {
+		return false;
+	}
+	for (idx_t i = 0; i < function.children.size(); i++) {
+		if (i != argument_idx && !function.children[i]->IsFoldable()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Returns the sorted column of "input" that the expression is an order-preserving function of (if any)
+static optional_idx GetSortedArgument(const Expression &expr, bool &injective) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_REF:
+		injective = true;
+		return expr.Cast<BoundReferenceExpression>().index;
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		idx_t argument_idx;
+		if (!IsOrderPreservingFunction(function, argument_idx, injective)) {
+			return optional_idx();
+		}
+		auto &argument = *function.children[argument_idx];
+		if (argument.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return optional_idx();
+		}
+		return argument.Cast<BoundReferenceExpression>().index;
+	}
+	default:
+		return optional_idx();
+	}
+}
+
+//! Given the sorted columns of the input, returns the sorted columns of the output of the expressions
+static vector<SortedColumn> ProjectSortedColumns(const vector<SortedColumn> &input,
+                                                 const vector<unique_ptr<Expression>> &expressions) {
+	vector<SortedColumn> result;
+	for (auto &sorted_column : input) {
+		bool found_injective = false;
+		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
+			bool injective;
+			auto argument = GetSortedArgument(*expressions[expr_idx], injective);
+			if (!argument.IsValid() || argument.GetIndex() != sorted_column.index) {
+				continue;
+			}
+			injective = injective && sorted_column.injective;
+			result.emplace_back(expr_idx, injective, sorted_column.type, sorted_column.null_order);
+			found_injective = found_injective || injective;
+		}
+		if (!found_injective) {
+			// The next sort key is no longer visible
+			break;
+		}
+	}
+	return result;
+}
+
+static vector<SortedColumn> GetSortedColumns(const PhysicalOperator &op) {
+	vector<SortedColumn> result;
+	switch (op.type) {
+	case PhysicalOperatorType::ORDER_BY: {
+		auto &order = op.Cast<PhysicalOrder>();
+		for (auto &node : order.orders) {
+			if (node.expression->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+				break;
+			}
+			auto index = node.expression->Cast<BoundReferenceExpression>().index;
+			auto entry = std::find(order.projections.begin(), order.projections.end(), index);
+			if (entry == order.projections.end()) {
+				break;
+			}
+			result.emplace_back(NumericCast<idx_t>(entry - order.projections.begin()), true, node.type,
+			                    node.null_order);
+		}
+		break;
+	}
+	case PhysicalOperatorType::PROJECTION: {
+		auto &projection = op.Cast<PhysicalProjection>();
+		result = ProjectSortedColumns(GetSortedColumns(*op.children[0]), projection.select_list);
+		break;
+	}
+	case PhysicalOperatorType::FILTER:
+		result = GetSortedColumns(*op.children[0]);
+		break;
+	default:
+		break;
+	}
+	return result;
+}
+
+bool PhysicalStreamingAggregate::CanStreamGroups(const PhysicalOperator &plan,
+                                                 const vector<unique_ptr<Expression>> &groups) {
+	// The rows of each group are adjacent if the groups are (order-preserving functions of) a prefix of the sort keys
+	auto sorted_groups = ProjectSortedColumns(GetSortedColumns(plan), groups);
+	vector<bool> group_is_sorted(groups.size(), false);
+	for (auto &sorted_group : sorted_groups) {
+		group_is_sorted[sorted_group.index] = true;
+	}
+	for (const auto is_sorted : group_is_sorted) {
+		if (!is_sorted) {
+			return false;
+		}
+	}
+	return !groups.empty();
+}
+
+bool PhysicalStreamingAggregate::IsSortedOn(const PhysicalOperator &plan, const vector<BoundOrderByNode> &orders) {
+	// Each order has to be (an order-preserving function of) the corresponding sort key, in the same direction
+	auto sorted_columns = GetSortedColumns(plan);
+	if (orders.empty() || orders.size() > sorted_columns.size()) {
+		return false;
+	}
+	for (idx_t order_idx = 0; order_idx < orders.size(); order_idx++) {
+		auto &order = orders[order_idx];
+		auto &sorted_column = sorted_columns[order_idx];
+		bool injective;
+		auto argument = GetSortedArgument(*order.expression, injective);
+		if (!argument.IsValid() || argument.GetIndex() != sorted_column.index) {
+			return false;
+		}
+		if (order.type != sorted_column.type || order.null_order != sorted_column.null_order) {
+			return false;
+		}
+		if (order_idx + 1 < orders.size() && !(injective && sorted_column.injective)) {
+			// Ties of a non-injective key are not sorted on the next key
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+	    : allocator(Allocator::Get(context.client)), row_state(allocator),
+	      current_allocator(Allocator::Get(context.client)), current_row_state(current_allocator),
+	      addresses(LogicalType::POINTER), run_addresses(LogicalType::POINTER), result_addresses(LogicalType::POINTER),
+	      current_addresses(LogicalType::POINTER), has_current(false) {
+		layout.Initialize(op.aggregate_objects);
+		row_width = layout.GetRowWidth();
+		run_states = make_unsafe_uniq_array_uninitialized<data_t>(STANDARD_VECTOR_SIZE * row_width);
+		current_state = make_unsafe_uniq_array_uninitialized<data_t>(row_width);
+
+		group_chunk.InitializeEmpty(op.group_types);
+		if (!op.payload_types.empty()) {
+			aggregate_input_chunk.InitializeEmpty(op.payload_types);
+		}
+		filter_set.Initialize(context.client, op.aggregate_objects, op.payload_types);
+
+		next_sel.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			next_sel.set_index(i, i + 1);
+		}
+		equal_sel[0].Initialize(STANDARD_VECTOR_SIZE);
+		equal_sel[1].Initialize(STANDARD_VECTOR_SIZE);
+		run_starts.Initialize(STANDARD_VECTOR_SIZE);
+	}
+
+	~StreamingAggregateState() override {
+		if (has_current) {
+			DestroyCurrentState();
+		}
+	}
+
+	//! Destroys the state of the current group
+	void DestroyCurrentState() {
+		if (layout.HasDestructor()) {
+			FlatVector::GetData<data_ptr_t>(current_addresses)[0] = current_state.get();
+			RowOperations::DestroyStates(current_row_state, layout, current_addresses, 1);
+		}
+		has_current = false;
+	}
+
+	//! Combines the state of a run into the state of the current group. The data of the run is copied into the
+	//! allocator of the current group, so the allocator of the chunk can be reset afterwards
+	void CombineIntoCurrentState(data_ptr_t run_state) {
+		auto sources = FlatVector::GetData<data_ptr_t>(result_addresses);
+		auto targets = FlatVector::GetData<data_ptr_t>(current_addresses);
+		idx_t offset = layout.GetAggrOffset();
+		for (auto &aggr : layout.GetAggregates()) {
+			sources[0] = run_state + offset;
+			targets[0] = current_state.get() + offset;
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), current_allocator,
+			                                   AggregateCombineType::PRESERVE_INPUT);
+			aggr.function.combine(result_addresses, current_addresses, aggr_input_data, 1);
+			offset += aggr.payload_size;
+		}
+		if (layout.HasDestructor()) {
+			sources[0] = run_state;
+			RowOperations::DestroyStates(row_state, layout, result_addresses, 1);
+		}
+	}
+
+	//! Layout of the aggregate states
+	TupleDataLayout layout;
+	idx_t row_width;
+	//! Allocator for the aggregate states of the groups in the current chunk, reset after every chunk
+	ArenaAllocator allocator;
+	RowOperationsState row_state;
+	//! Allocator for the aggregate state of the current group, reset once the current group is complete
+	ArenaAllocator current_allocator;
+	RowOperationsState current_row_state;
+
+	DataChunk group_chunk;
+	DataChunk aggregate_input_chunk;
+	AggregateFilterDataSet filter_set;
+
+	//! Selection vector that selects the next row (i -> i + 1)
+	SelectionVector next_sel;
+	//! Rows that have the same groups as the next row
+	SelectionVector equal_sel[2];
+	//! The rows at which a group starts in the current chunk
+	SelectionVector run_starts;
+
+	//! Aggregate states for the groups in the current chunk
+	unsafe_unique_array<data_t> run_states;
+	//! Pointers to the aggregate state of each row
+	Vector addresses;
+	//! Pointers to the aggregate state of each group in the current chunk
+	Vector run_addresses;
+	//! Pointers to the aggregate states of the groups we output
+	Vector result_addresses;
+	//! Pointer to the aggregate state of the current group
+	Vector current_addresses;
+
+	//! Whether there is a current group
+	bool has_current;
+	//! The values of the current group, which may continue in the next chunk
+	vector<Value> current_group;
+	//! The aggregate state of the current group
+	unsafe_unique_array<data_t> current_state;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+//! Finds the rows at which a new group starts (the first row always starts one), returns the number of groups
+static idx_t FindGroupStarts(StreamingAggregateState &state, DataChunk &group_chunk) {
+	const auto count = group_chunk.size();
+	auto &run_starts = state.run_starts;
+	run_starts.set_index(0, 0);
+	if (count == 1) {
+		return 1;
+	}
+
+	// Compare each row with the next one, column by column, keeping the rows that are still equal
+	optional_ptr<const SelectionVector> sel;
+	idx_t equal_count = count - 1;
+	for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount() && equal_count > 0; col_idx++) {
+		auto &col = group_chunk.data[col_idx];
+		Vector next(col, state.next_sel, count - 1);
+		auto &equal_sel = state.equal_sel[col_idx % 2];
+		equal_count = VectorOperations::NotDistinctFrom(next, col, sel, equal_count, &equal_sel, nullptr);
+		sel = &equal_sel;
+	}
+
+	// Rows that are not equal to their predecessor start a new group
+	idx_t run_count = 1;
+	idx_t equal_idx = 0;
+	for (idx_t i = 0; i < count - 1; i++) {
+		if (equal_idx < equal_count && sel->get_index(equal_idx) == i) {
+			equal_idx++;
+			continue;
+		}
+		run_starts.set_index(run_count++, i + 1);
+	}
+	return run_count;
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	auto &group_chunk = state.group_chunk;
+	auto &aggregate_input_chunk = state.aggregate_input_chunk;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = groups[group_idx];
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[group_idx].Reference(input.data[bound_ref_expr.index]);
+	}
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child_expr : aggr.children) {
+			D_ASSERT(child_expr->type == ExpressionType::BOUND_REF);
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			aggregate_input_chunk.data[aggregate_input_idx++].Reference(input.data[bound_ref_expr.index]);
+		}
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto it = filter_indexes.find(aggr.filter.get());
+			D_ASSERT(it != filter_indexes.end());
+			aggregate_input_chunk.data[aggregate_input_idx++].Reference(input.data[it->second]);
+		}
+	}
+	group_chunk.SetCardinality(count);
+	aggregate_input_chunk.SetCardinality(count);
+
+	// Split the chunk into runs of equal groups, and check whether the first run continues the current group
+	const auto run_count = FindGroupStarts(state, group_chunk);
+	bool continues_current = state.has_current;
+	for (idx_t col_idx = 0; continues_current && col_idx < groups.size(); col_idx++) {
+		continues_current = Value::NotDistinctFrom(group_chunk.GetValue(col_idx, 0), state.current_group[col_idx]);
+	}
+
+	// Initialize the aggregate states of the runs, and point every row to the state of its run
+	auto run_addresses = FlatVector::GetData<data_ptr_t>(state.run_addresses);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		run_addresses[run_idx] = state.run_states.get() + run_idx * state.row_width;
+	}
+	auto &layout = state.layout;
+	RowOperations::InitializeStates(layout, state.run_addresses, *FlatVector::IncrementalSelectionVector(),
+	                                run_count);
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	idx_t run_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (run_idx + 1 < run_count && state.run_starts.get_index(run_idx + 1) == i) {
+			run_idx++;
+		}
+		addresses[i] = run_addresses[run_idx] + layout.GetAggrOffset();
+	}
+
+	// Update the aggregates
+	auto &aggregate_objects = layout.GetAggregates();
+	idx_t payload_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_objects.size(); aggr_idx++) {
+		auto &aggr = aggregate_objects[aggr_idx];
+		if (aggr.filter) {
+			RowOperations::UpdateFilteredStates(state.row_state, state.filter_set.GetFilterData(aggr_idx), aggr,
+			                                    state.addresses, aggregate_input_chunk, payload_idx);
+		} else {
+			RowOperations::UpdateStates(state.row_state, aggr, state.addresses, aggregate_input_chunk, payload_idx,
+			                            count);
+		}
+		payload_idx += aggr.child_count;
+		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), count);
+	}
+
+	// Every group but the last one in this chunk is complete
+	auto result_addresses = FlatVector::GetData<data_ptr_t>(state.result_addresses);
+	auto current_addresses = FlatVector::GetData<data_ptr_t>(state.current_addresses);
+	idx_t result_count = 0;
+	bool current_is_last_run = false;
+	if (state.has_current) {
+		if (continues_current) {
+			// The first run continues the current group: append it to the current group, which comes first
+			state.CombineIntoCurrentState(run_addresses[0]);
+			run_addresses[0] = state.current_state.get();
+			current_is_last_run = run_count == 1;
+		} else {
+			// The current group is complete
+			for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+				chunk.data[col_idx].SetValue(result_count, state.current_group[col_idx]);
+			}
+			result_addresses[result_count++] = state.current_state.get();
+		}
+	}
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(group_chunk.data[col_idx], chunk.data[col_idx], state.run_starts, run_count - 1, 0,
+		                       result_count);
+	}
+	for (idx_t i = 0; i + 1 < run_count; i++) {
+		result_addresses[result_count++] = run_addresses[i];
+	}
+	chunk.SetCardinality(result_count);
+	if (result_count > 0) {
+		RowOperations::FinalizeStates(state.row_state, layout, state.result_addresses, chunk, groups.size());
+		if (layout.HasDestructor()) {
+			RowOperations::DestroyStates(state.row_state, layout, state.result_addresses, result_count);
+		}
+	}
+
+	if (!current_is_last_run) {
+		// The last run becomes the current group, as it may continue in the next chunk
+		if (state.has_current) {
+			// The previous current group was finalized and destroyed above, so its data can be freed
+			state.has_current = false;
+			state.current_allocator.Reset();
+		}
+		const auto last_row = count - 1;
+		state.current_group.clear();
+		for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+			state.current_group.push_back(group_chunk.GetValue(col_idx, last_row));
+		}
+		current_addresses[0] = state.current_state.get();
+		RowOperations::InitializeStates(layout, state.current_addresses, *FlatVector::IncrementalSelectionVector(),
+		                                1);
+		state.CombineIntoCurrentState(run_addresses[run_count - 1]);
+		state.has_current = true;
+	}
+	// The states of all runs in this chunk are either destroyed or copied into the current group
+	state.allocator.Reset();
+
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_current) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+
+	// Emit the last group
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		chunk.data[col_idx].SetValue(0, state.current_group[col_idx]);
+	}
+	chunk.SetCardinality(1);
+	FlatVector::GetData<data_ptr_t>(state.result_addresses)[0] = state.current_state.get();
+	RowOperations::FinalizeStates(state.row_state, state.layout, state.result_addresses, chunk, groups.size());
+	state.DestroyCurrentState();
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			aggregate_info += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	result["Aggregates"] = aggregate_info;
+	result["Estimated Cardinality"] = StringUtil::Format("%llu", estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -2,6 +2,7 @@
 
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -54,6 +55,35 @@ public:
 				distinct_args.Initialize(allocator, arg_types);
 				distinct_sel.Initialize();
 			}
+			bounded = ComputePreceding(client, wexpr, preceding);
+			if (bounded && !arg_types.empty()) {
+				remove_cursor.Initialize(allocator, arg_types);
+				frame_chunks[0].Initialize(allocator, arg_types);
+				frame_chunks[1].Initialize(allocator, arg_types);
+			}
+		}
+
+		//! Whether the frame is ROWS BETWEEN <preceding> PRECEDING AND CURRENT ROW with a small constant offset
+		static bool ComputePreceding(ClientContext &context, BoundWindowExpression &wexpr, idx_t &preceding) {
+			if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS || wexpr.end != WindowBoundary::CURRENT_ROW_ROWS) {
+				return false;
+			}
+			if (!wexpr.start_expr || wexpr.start_expr->HasParameter() || !wexpr.start_expr->IsFoldable()) {
+				return false;
+			}
+			auto start_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.start_expr);
+			Value bigint_value;
+			if (start_value.IsNull() ||
+			    !start_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+				return false;
+			}
+			// Negative offsets are an error, which is raised by the blocking window
+			const auto offset = bigint_value.GetValue<int64_t>();
+			if (offset < 0) {
+				return false;
+			}
+			preceding = idx_t(offset);
+			return preceding < LeadLagState::MAX_BUFFER;
 		}
 
 		~AggregateState() {
@@ -65,6 +95,7 @@ public:
 		}
 
 		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
+		void ExecuteBounded(DataChunk &args, const ValidityMask &filter_mask, Vector &result);
 
 		//! The aggregate expression
 		BoundWindowExpression &wexpr;
@@ -105,6 +136,20 @@ public:
 		SelectionVector distinct_sel;
 		//! Pointers to groups in the hash table.
 		Vector addresses;
+
+		//! Whether the frame only contains a bounded number of preceding rows
+		bool bounded = false;
+		//! The number of preceding rows in the frame
+		idx_t preceding = 0;
+		//! The arguments of the last (preceding + 1) rows, which are removed from the state when they leave the frame.
+		//! Rows that don't pass the FILTER are stored as NULLs. We alternate between the two chunks.
+		DataChunk frame_chunks[2];
+		//! The index of the current frame chunk
+		idx_t frame_idx = 0;
+		//! The number of rows in the frame that have been added to the state
+		idx_t frame_count = 0;
+		//! Argument cursor for the rows leaving the frame
+		DataChunk remove_cursor;
 	};
 
 	struct LeadLagState {
@@ -330,21 +375,49 @@ public:
 	DataChunk shifted;
 };
 
-bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr,
+                                                  const PhysicalOperator &child) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
-	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
-	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+	if (!wexpr.partitions.empty() || wexpr.ignore_nulls || wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	// We can stream an ORDER BY if the input is already sorted on it (the order of ties is arbitrary anyway)
+	const auto ordered = !wexpr.orders.empty();
+	if (ordered && !PhysicalStreamingAggregate::IsSortedOn(child, wexpr.orders)) {
 		return false;
 	}
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+			return true;
+		}
+		// ...or if the frame is a few preceding rows that can be removed from the running state again
+		idx_t preceding;
+		if (!StreamingWindowState::AggregateState::ComputePreceding(context, wexpr, preceding)) {
+			return false;
+		}
+		if (wexpr.children.empty()) {
+			return !wexpr.filter_expr;
+		}
+		auto &aggregate = *wexpr.aggregate;
+		if (wexpr.distinct || !aggregate.remove || aggregate.destructor) {
+			return false;
+		}
+		for (auto &arg : wexpr.children) {
+			if (arg->return_type.IsNested()) {
+				return false;
+			}
+		}
+		return true;
+	}
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
 	case ExpressionType::WINDOW_RANK_DENSE:
+		// These are constant only if all rows are peers
+		return !ordered;
 	case ExpressionType::WINDOW_ROW_NUMBER:
 		return true;
 	case ExpressionType::WINDOW_LAG:
@@ -395,6 +468,16 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
 		auto data = FlatVector::GetData<int64_t>(result);
 		auto &unfiltered = aggr_state.unfiltered;
+		if (bounded) {
+			//	Bounded COUNT(*) is only streamed without a FILTER
+			D_ASSERT(!wexpr.filter_expr);
+			const auto frame_size = int64_t(preceding + 1);
+			for (idx_t i = 0; i < count; ++i) {
+				++unfiltered;
+				data[i] = MinValue<int64_t>(unfiltered, frame_size);
+			}
+			return;
+		}
 		for (idx_t i = 0; i < count; ++i) {
 			unfiltered += int64_t(filter_mask.RowIsValid(i));
 			data[i] = unfiltered;
@@ -407,6 +490,11 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	executor.Execute(input, arg_chunk);
 	arg_chunk.Flatten();
 
+	if (bounded) {
+		ExecuteBounded(arg_chunk, filter_mask, result);
+		return;
+	}
+
 	// Update the distinct hash table
 	ValidityMask distinct_mask;
 	if (aggr_state.distinct) {
@@ -470,6 +558,98 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	}
 }
 
+//! Reference a one row slice of the source chunk in the cursor. The row is selected by changing the selection vector.
+static void ReferenceCursor(DataChunk &cursor, DataChunk &source, SelectionVector &sel) {
+	cursor.Reset();
+	cursor.Slice(sel, 1);
+	for (column_t col_idx = 0; col_idx < source.ColumnCount(); ++col_idx) {
+		DictionaryVector::Child(cursor.data[col_idx]).Reference(source.data[col_idx]);
+	}
+}
+
+//! Whether the row of a flat chunk can update the state. The removable aggregates ignore NULLs.
+static bool RowContributes(DataChunk &chunk, idx_t row) {
+	for (auto &col : chunk.data) {
+		if (!FlatVector::Validity(col).RowIsValid(row)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void StreamingWindowState::AggregateState::ExecuteBounded(DataChunk &args, const ValidityMask &filter_mask,
+                                                         Vector &result) {
+	//	We treat frame || args as a logical unified buffer.
+	//	Each row adds itself to the state and removes the row (preceding + 1) rows before it.
+	auto &aggregate = *wexpr.aggregate;
+	const idx_t count = args.size();
+	auto &frame = frame_chunks[frame_idx];
+	const idx_t buffered = frame.size();
+
+	sel_t s = 0;
+	SelectionVector sel(&s);
+	ReferenceCursor(arg_cursor, args, sel);
+
+	sel_t r = 0;
+	SelectionVector remove_sel(&r);
+	bool remove_from_frame = buffered > 0;
+	ReferenceCursor(remove_cursor, remove_from_frame ? frame : args, remove_sel);
+
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+	for (idx_t i = 0; i < count; ++i) {
+		if (buffered + i > preceding) {
+			const auto removed = buffered + i - preceding - 1;
+			bool contributes;
+			if (removed < buffered) {
+				r = UnsafeNumericCast<sel_t>(removed);
+				contributes = RowContributes(frame, removed);
+			} else {
+				if (remove_from_frame) {
+					remove_from_frame = false;
+					ReferenceCursor(remove_cursor, args, remove_sel);
+				}
+				r = UnsafeNumericCast<sel_t>(removed - buffered);
+				contributes = filter_mask.RowIsValid(r) && RowContributes(args, r);
+			}
+			if (contributes) {
+				aggregate.remove(remove_cursor.data.data(), aggr_input_data, remove_cursor.ColumnCount(), statev, 1);
+				--frame_count;
+			}
+		}
+		if (filter_mask.RowIsValid(i) && RowContributes(args, i)) {
+			s = UnsafeNumericCast<sel_t>(i);
+			aggregate.update(arg_cursor.data.data(), aggr_input_data, arg_cursor.ColumnCount(), statev, 1);
+			++frame_count;
+		}
+		if (!frame_count) {
+			//	Removing values can't restore the "no values" state (e.g., SUM returning NULL)
+			aggregate.initialize(aggregate, state.data());
+		}
+		aggregate.finalize(statev, aggr_input_data, result, 1, i);
+	}
+
+	//	Keep the arguments of the last (preceding + 1) rows for the next chunk
+	auto &next = frame_chunks[1 - frame_idx];
+	next.Reset();
+	const auto keep = MinValue<idx_t>(preceding + 1, buffered + count);
+	const auto from_args = MinValue<idx_t>(keep, count);
+	const auto from_frame = keep - from_args;
+	for (column_t col_idx = 0; col_idx < args.ColumnCount(); ++col_idx) {
+		auto &target = next.data[col_idx];
+		VectorOperations::Copy(frame.data[col_idx], target, buffered, buffered - from_frame, 0);
+		VectorOperations::Copy(args.data[col_idx], target, count, count - from_args, from_frame);
+		if (!filter_mask.AllValid()) {
+			for (idx_t i = count - from_args; i < count; ++i) {
+				if (!filter_mask.RowIsValid(i)) {
+					FlatVector::SetNull(target, from_frame + i - (count - from_args), true);
+				}
+			}
+		}
+	}
+	next.SetCardinality(keep);
+	frame_idx = 1 - frame_idx;
+}
+
 void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &delayed,
                                                GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
@@ -208,8 +208,8 @@ public:
 		auto &distinct_info = *op.distinct_collection_info;
 
 		for (auto &idx : distinct_info.indices) {
-			idx_t table_idx = distinct_info.table_map[idx];
-			if (data.radix_tables[table_idx] == nullptr) {
+			idx_t table_idx = data.IsShared() ? 0 : distinct_info.table_map[idx];
+			if (data.radix_tables[table_idx] == nullptr || radix_states[table_idx]) {
 				// This aggregate has identical input as another aggregate, so no table is created for it
 				continue;
 			}
@@ -259,16 +259,18 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 		auto &aggregate = aggregates[idx]->Cast<BoundAggregateExpression>();
 
 		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
+		if (distinct_data->table_aggregates[table_idx] != idx) {
 			// This distinct aggregate shares its data with another
 			continue;
 		}
-		D_ASSERT(distinct_data->radix_tables[table_idx]);
-		auto &radix_table = *distinct_data->radix_tables[table_idx];
-		auto &radix_global_sink = *distinct_state.radix_states[table_idx];
-		auto &radix_local_sink = *sink.radix_states[table_idx];
+		const auto radix_idx = distinct_data->IsShared() ? 0 : table_idx;
+		D_ASSERT(distinct_data->radix_tables[radix_idx]);
+		auto &radix_table = *distinct_data->radix_tables[radix_idx];
+		auto &radix_global_sink = *distinct_state.radix_states[radix_idx];
+		auto &radix_local_sink = *sink.radix_states[radix_idx];
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, input.interrupt_state};
 
+		reference<DataChunk> distinct_input(chunk);
 		if (aggregate.filter) {
 			// The hashtable can apply a filter, but only on the payload
 			// And in our case, we need to filter the groups (the distinct aggr children)
@@ -277,10 +279,16 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 			auto &filtered_data = sink.filter_set.GetFilterData(idx);
 			idx_t count = filtered_data.ApplyFilter(chunk);
 			filtered_data.filtered_payload.SetCardinality(count);
+			distinct_input = filtered_data.filtered_payload;
+		}
 
-			radix_table.Sink(context, filtered_data.filtered_payload, sink_input, empty_chunk, distinct_filter);
+		if (distinct_data->IsShared()) {
+			DataChunk shared_chunk;
+			shared_chunk.InitializeEmpty(distinct_data->shared_data->group_types);
+			distinct_data->PopulateSharedChunk(table_idx, distinct_input.get(), shared_chunk);
+			radix_table.Sink(context, shared_chunk, sink_input, empty_chunk, distinct_filter);
 		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, distinct_filter);
+			radix_table.Sink(context, distinct_input.get(), sink_input, empty_chunk, distinct_filter);
 		}
 	}
 }
@@ -439,6 +447,7 @@ public:
 
 private:
 	TaskExecutionResult AggregateDistinct();
+	TaskExecutionResult AggregateSharedDistinct(ExecutionContext &execution_context);
 
 private:
 	const PhysicalUngroupedAggregate &op;
@@ -459,7 +468,13 @@ void UngroupedDistinctAggregateFinalizeEvent::Schedule() {
 	idx_t n_tasks = 0;
 	idx_t payload_idx = 0;
 	idx_t next_payload_idx = 0;
-	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
+	if (distinct_data.IsShared()) {
+		// All distinct aggregates are computed from a single scan of the shared table
+		auto &radix_table_p = *distinct_data.radix_tables[0];
+		n_tasks += radix_table_p.MaxThreads(*gstate.distinct_state->radix_states[0]);
+		global_source_states.push_back(radix_table_p.GetGlobalSourceState(context));
+	}
+	for (idx_t agg_idx = 0; agg_idx < aggregates.size() && !distinct_data.IsShared(); agg_idx++) {
 		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
 
 		// Forward the payload idx
@@ -514,6 +529,16 @@ TaskExecutionResult UngroupedDistinctAggregateFinalizeTask::AggregateDistinct()
 
 	auto &finalize_event = event->Cast<UngroupedDistinctAggregateFinalizeEvent>();
 
+	if (distinct_data.IsShared()) {
+		auto res = AggregateSharedDistinct(execution_context);
+		if (res == TaskExecutionResult::TASK_BLOCKED) {
+			return res;
+		}
+		gstate.state.CombineDistinct(state, distinct_data);
+		finalize_event.FinalizeTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
 	// Now loop through the distinct aggregates, scanning the distinct HTs
 
 	// This needs to be preserved in case the radix_table.GetData blocks
@@ -577,6 +602,56 @@ TaskExecutionResult UngroupedDistinctAggregateFinalizeTask::AggregateDistinct()
 	return TaskExecutionResult::TASK_FINISHED;
 }
 
+TaskExecutionResult
+UngroupedDistinctAggregateFinalizeTask::AggregateSharedDistinct(ExecutionContext &execution_context) {
+	auto &distinct_state = *gstate.distinct_state;
+	auto &distinct_data = *op.distinct_data;
+	auto &aggregates = op.aggregates;
+	auto &finalize_event = event->Cast<UngroupedDistinctAggregateFinalizeEvent>();
+
+	auto &radix_table = *distinct_data.radix_tables[0];
+	if (!blocked) {
+		radix_table_lstate = radix_table.GetLocalSourceState(execution_context);
+	}
+	auto &sink = *distinct_state.radix_states[0];
+	InterruptState interrupt_state(shared_from_this());
+	OperatorSourceInput source_input {*finalize_event.global_source_states[0], *radix_table_lstate, interrupt_state};
+
+	DataChunk output_chunk;
+	output_chunk.Initialize(executor.context, distinct_state.distinct_output_chunks[0]->GetTypes());
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+
+	// Scan the shared table once, and update the aggregates with the rows of their tables
+	while (true) {
+		output_chunk.Reset();
+
+		auto res = radix_table.GetData(execution_context, output_chunk, sink, source_input);
+		if (res == SourceResultType::FINISHED) {
+			D_ASSERT(output_chunk.size() == 0);
+			break;
+		} else if (res == SourceResultType::BLOCKED) {
+			blocked = true;
+			return TaskExecutionResult::TASK_BLOCKED;
+		}
+
+		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
+			if (!distinct_data.IsDistinct(agg_idx)) {
+				continue;
+			}
+			const auto table_idx = distinct_data.info.table_map.at(agg_idx);
+			DataChunk payload_chunk;
+			payload_chunk.InitializeEmpty(distinct_data.grouped_aggregate_data[table_idx]->group_types);
+			distinct_data.SliceSharedOutput(table_idx, output_chunk, payload_chunk, sel);
+			if (payload_chunk.size() == 0) {
+				continue;
+			}
+			aggregate_state.Sink(payload_chunk, 0, agg_idx);
+		}
+	}
+	blocked = false;
+	return TaskExecutionResult::TASK_FINISHED;
+}
+
 SinkFinalizeType PhysicalUngroupedAggregate::FinalizeDistinct(Pipeline &pipeline, Event &event, ClientContext &context,
                                                               GlobalSinkState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<UngroupedAggregateGlobalSinkState>();
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/helper/physical_reset.hpp"
 
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/helper/physical_set.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
 
@@ -21,6 +22,7 @@ void PhysicalReset::ResetExtensionVariable(ExecutionContext &context, DBConfig &
 
 SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const {
 	if (scope == SetScope::VARIABLE) {
+		PhysicalSet::InvalidateCaches(context.client, scope);
 		auto &client_config = ClientConfig::GetConfig(context.client);
 		client_config.ResetUserVariable(name);
 		return SourceResultType::FINISHED;
@@ -36,6 +38,7 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 			entry = config.extension_parameters.find(name);
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
+		PhysicalSet::InvalidateCaches(context.client, scope);
 		ResetExtensionVariable(context, config, entry->second);
 		return SourceResultType::FINISHED;
 	}
@@ -51,6 +54,7 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 		}
 	}
 
+	PhysicalSet::InvalidateCaches(context.client, variable_scope);
 	switch (variable_scope) {
 	case SetScope::GLOBAL: {
 		if (!option->set_global) {
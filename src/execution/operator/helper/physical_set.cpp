@@ -3,9 +3,20 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/result_cache.hpp"
 
 namespace duckdb {
 
+void PhysicalSet::InvalidateCaches(ClientContext &context, SetScope scope) {
+	if (scope == SetScope::GLOBAL) {
+		PlanCache::Get(context).Clear();
+		ResultCache::Get(context).Clear();
+	} else {
+		PlanCache::Get(context).RemoveConnection(context);
+	}
+}
+
 void PhysicalSet::SetExtensionVariable(ClientContext &context, ExtensionOption &extension_option, const string &name,
                                        SetScope scope, const Value &value) {
 	auto &config = DBConfig::GetConfig(context);
@@ -35,6 +46,7 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 			entry = config.extension_parameters.find(name);
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
+		InvalidateCaches(context.client, scope);
 		SetExtensionVariable(context.client, entry->second, name, scope, value);
 		return SourceResultType::FINISHED;
 	}
@@ -48,6 +60,7 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 		}
 	}
 
+	InvalidateCaches(context.client, variable_scope);
 	Value input_val = value.CastAs(context.client, option->parameter_type);
 	switch (variable_scope) {
 	case SetScope::GLOBAL: {
@@ -1,4 +1,5 @@
 #include "duckdb/execution/operator/helper/physical_set_variable.hpp"
+#include "duckdb/execution/operator/helper/physical_set.hpp"
 #include "duckdb/main/client_config.hpp"
 
 namespace duckdb {
@@ -19,6 +20,8 @@ SinkResultType PhysicalSetVariable::Sink(ExecutionContext &context, DataChunk &c
 	}
 	auto &config = ClientConfig::GetConfig(context.client);
 	config.SetUserVariable(name, chunk.GetValue(0, 0));
+	// variables are bound as constants in cached plans
+	PhysicalSet::InvalidateCaches(context.client, SetScope::SESSION);
 	return SinkResultType::FINISHED;
 }
 
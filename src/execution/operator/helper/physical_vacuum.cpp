@@ -1,7 +1,13 @@
 #include "duckdb/execution/operator/helper/physical_vacuum.hpp"
 
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/statistics/column_dependency.hpp"
+#include "duckdb/storage/statistics/column_histogram.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
@@ -36,18 +42,36 @@ unique_ptr<LocalSinkState> PhysicalVacuum::GetLocalSinkState(ExecutionContext &c
 class VacuumGlobalSinkState : public GlobalSinkState {
 public:
 	explicit VacuumGlobalSinkState(VacuumInfo &info, optional_ptr<TableCatalogEntry> table) {
-		for (const auto &column_name : info.columns) {
-			auto &column = table->GetColumn(column_name);
+		vector<LogicalType> sample_types;
+		for (idx_t col_idx = 0; col_idx < info.columns.size(); col_idx++) {
+			auto &column = table->GetColumn(info.columns[col_idx]);
 			if (DistinctStatistics::TypeIsSupported(column.GetType())) {
 				column_distinct_stats.push_back(make_uniq<DistinctStatistics>());
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (ColumnHistogram::TypeIsSupported(column.GetType())) {
+				sample_columns.push_back(col_idx);
+				sample_types.push_back(column.GetType());
+			}
+		}
+		// the sample uses a fixed seed, but with multiple threads the rows are sunk in a nondeterministic order, so the
+		// histograms of the same data can differ between runs
+		sample = make_uniq<ReservoirSample>(ColumnHistogram::SAMPLE_SIZE);
+		if (!sample_types.empty()) {
+			sample_chunk.InitializeEmpty(sample_types);
 		}
 	};
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+
+	//! A sample of the rows of the table, from which the histograms and column dependencies are built
+	mutex sample_lock;
+	unique_ptr<ReservoirSample> sample;
+	//! The columns that are sampled, and the chunk that references them
+	vector<idx_t> sample_columns;
+	DataChunk sample_chunk;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
@@ -55,6 +79,7 @@ unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &co
 }
 
 SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<VacuumGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<VacuumLocalSinkState>();
 	D_ASSERT(lstate.column_distinct_stats.size() == column_id_map.size());
 
@@ -65,6 +90,16 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk,
 		lstate.column_distinct_stats[col_idx]->Update(chunk.data[col_idx], chunk.size(), false);
 	}
 
+	if (!gstate.sample_columns.empty()) {
+		lock_guard<mutex> guard(gstate.sample_lock);
+		auto &sample_chunk = gstate.sample_chunk;
+		for (idx_t i = 0; i < gstate.sample_columns.size(); i++) {
+			sample_chunk.data[i].Reference(chunk.data[gstate.sample_columns[i]]);
+		}
+		sample_chunk.SetCardinality(chunk.size());
+		gstate.sample->AddToReservoir(sample_chunk);
+	}
+
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -93,10 +128,56 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
+	BuildHistograms(sink);
+	// the statistics are not written to the WAL: make sure the next checkpoint persists them
+	StorageManager::Get(tbl->catalog).SetStatisticsChanged();
 
 	return SinkFinalizeType::READY;
 }
 
+void PhysicalVacuum::BuildHistograms(GlobalSinkState &state) const {
+	auto &sink = state.Cast<VacuumGlobalSinkState>();
+	auto tbl = table;
+	auto &storage = tbl->GetStorage();
+	auto sample = sink.sample->GetChunk();
+	D_ASSERT(!sample || sample->size() <= STANDARD_VECTOR_SIZE);
+	auto count = sample ? sample->size() : 0;
+
+	vector<idx_t> analyzed_columns;
+	vector<idx_t> dependency_columns;
+	vector<vector<hash_t>> dependency_hashes;
+	for (idx_t i = 0; i < sink.sample_columns.size(); i++) {
+		auto column_id = column_id_map.at(sink.sample_columns[i]);
+		analyzed_columns.push_back(column_id);
+		if (count == 0) {
+			storage.SetHistogram(column_id, nullptr);
+			continue;
+		}
+		Vector hashes(LogicalType::HASH, count);
+		VectorOperations::Hash(sample->data[i], hashes, count);
+		hashes.Flatten(count);
+		storage.SetHistogram(column_id, ColumnHistogram::Create(sample->data[i], hashes, count));
+		if (dependency_columns.size() < ColumnDependency::MAX_COLUMNS) {
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			dependency_columns.push_back(column_id);
+			dependency_hashes.emplace_back(hash_data, hash_data + count);
+		}
+	}
+
+	// replace the dependencies between the analyzed columns, and keep the others
+	auto dependencies = ColumnDependency::Compute(dependency_columns, dependency_hashes, count);
+	for (auto &dependency : storage.GetColumnDependencies()) {
+		auto analyzed_determinant = std::find(analyzed_columns.begin(), analyzed_columns.end(),
+		                                      dependency.determinant) != analyzed_columns.end();
+		auto analyzed_dependent = std::find(analyzed_columns.begin(), analyzed_columns.end(),
+		                                    dependency.dependent) != analyzed_columns.end();
+		if (!analyzed_determinant || !analyzed_dependent) {
+			dependencies.push_back(dependency);
+		}
+	}
+	storage.SetColumnDependencies(std::move(dependencies));
+}
+
 SourceResultType PhysicalVacuum::GetData(ExecutionContext &context, DataChunk &chunk,
                                          OperatorSourceInput &input) const {
 	// NOP
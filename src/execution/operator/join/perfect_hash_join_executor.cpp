@@ -8,6 +8,12 @@ namespace duckdb {
 PerfectHashJoinExecutor::PerfectHashJoinExecutor(const PhysicalHashJoin &join_p, JoinHashTable &ht_p,
                                                  PerfectHashJoinStats perfect_join_stats)
     : join(join_p), ht(ht_p), perfect_join_statistics(std::move(perfect_join_stats)) {
+	// the keys are laid out in the perfect hash table like a multi-dimensional array (first key varies fastest)
+	idx_t stride = 1;
+	for (auto &key_stats : perfect_join_statistics.keys) {
+		key_strides.push_back(stride);
+		stride *= key_stats.build_range + 1;
+	}
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
@@ -17,7 +23,8 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::BuildPerfectHashTable(const vector<LogicalType> &key_types) {
+	D_ASSERT(key_types.size() == perfect_join_statistics.keys.size());
 	// First, allocate memory for each build column
 	auto build_size = perfect_join_statistics.build_range + 1;
 	for (const auto &type : join.rhs_output_types) {
@@ -30,10 +37,10 @@ bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
 
 	// Now fill columns with build data
 
-	return FullScanHashTable(key_type);
+	return FullScanHashTable(key_types);
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable(const vector<LogicalType> &key_types) {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
@@ -49,19 +56,34 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	}
 
 	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	vector<Vector> build_keys;
+	build_keys.reserve(key_types.size());
+	for (idx_t key_idx = 0; key_idx < key_types.size(); key_idx++) {
+		build_keys.emplace_back(key_types[key_idx], key_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_keys[key_idx], key_count, key_idx);
+	}
 
-	// Now fill the selection vector using the build keys and create a sequential vector
+	// Now compute the position of each build tuple in the perfect hash table
 	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
 	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
+	auto slots = make_unsafe_uniq_array_uninitialized<idx_t>(key_count + 1);
+	for (idx_t i = 0; i < key_count; i++) {
+		sel_tuples.set_index(i, i);
+	}
+	const auto sel_count = ComputeSlots(build_keys, key_count, sel_tuples, key_count, slots.get());
 
-	// early out
-	if (!success) {
-		return false;
+	// and fill the selection vector, bailing out if there are any duplicate keys
+	for (idx_t i = 0; i < sel_count; i++) {
+		const auto slot = slots[sel_tuples.get_index(i)];
+		if (bitmap_build_idx[slot]) {
+			return false;
+		}
+		bitmap_build_idx[slot] = true;
+		sel_build.set_index(i, slot);
 	}
+	unique_keys = sel_count;
+
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
@@ -83,59 +105,87 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+//===--------------------------------------------------------------------===//
+// Slot Computation
+//===--------------------------------------------------------------------===//
+idx_t PerfectHashJoinExecutor::ComputeSlots(vector<Vector> &keys, idx_t count, SelectionVector &sel, idx_t sel_count,
+                                            idx_t slots[]) {
+	D_ASSERT(keys.size() == key_strides.size());
+	for (idx_t i = 0; i < sel_count; i++) {
+		slots[sel.get_index(i)] = 0;
+	}
+	for (idx_t key_idx = 0; key_idx < keys.size(); key_idx++) {
+		sel_count = ComputeSlotsSwitch(keys[key_idx], key_idx, count, sel, sel_count, slots);
+	}
+	return sel_count;
+}
+
+idx_t PerfectHashJoinExecutor::ComputeSlotsSwitch(Vector &source, idx_t key_idx, idx_t count, SelectionVector &sel,
+                                                  idx_t sel_count, idx_t slots[]) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int8_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int16_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int32_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<int64_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint8_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint16_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint32_t>(source, key_idx, count, sel, sel_count, slots);
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeSlots<uint64_t>(source, key_idx, count, sel, sel_count, slots);
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+idx_t PerfectHashJoinExecutor::TemplatedComputeSlots(Vector &source, idx_t key_idx, idx_t count,
+                                                     SelectionVector &sel, idx_t sel_count, idx_t slots[]) {
+	auto &key_stats = perfect_join_statistics.keys[key_idx];
+	const auto min_value = key_stats.build_min.GetValueUnsafe<T>();
+	const auto max_value = key_stats.build_max.GetValueUnsafe<T>();
+	const auto stride = key_strides[key_idx];
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
-		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
-		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	auto &validity = vector_data.validity;
+
+	idx_t result_count = 0;
+	if (validity.AllValid()) {
+		for (idx_t i = 0; i < sel_count; i++) {
+			const auto row_idx = sel.get_index(i);
+			const auto input_value = data[vector_data.sel->get_index(row_idx)];
+			// keep the row only if the value is in the range
+			if (min_value <= input_value && input_value <= max_value) {
+				// subtract min value to get the idx position within the domain of this key
+				slots[row_idx] += static_cast<idx_t>(input_value - min_value) * stride;
+				sel.set_index(result_count++, row_idx);
+			}
+		}
+	} else {
+		for (idx_t i = 0; i < sel_count; i++) {
+			const auto row_idx = sel.get_index(i);
+			const auto data_idx = vector_data.sel->get_index(row_idx);
+			if (!validity.RowIsValid(data_idx)) {
+				continue;
+			}
+			const auto input_value = data[data_idx];
+			// keep the row only if the value is in the range
+			if (min_value <= input_value && input_value <= max_value) {
+				// subtract min value to get the idx position within the domain of this key
+				slots[row_idx] += static_cast<idx_t>(input_value - min_value) * stride;
+				sel.set_index(result_count++, row_idx);
 			}
-			seq_sel_vec.set_index(sel_idx++, i);
 		}
 	}
-	return true;
+	return result_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -150,14 +200,15 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
+		slots = make_unsafe_uniq_array_uninitialized<idx_t>(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	//! The positions of the probe keys in the perfect hash table
+	unsafe_unique_array<idx_t> slots;
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -168,17 +219,31 @@ unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionCon
 OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &result, OperatorState &state_p) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
-	// keeps track of how many probe keys have a match
-	idx_t probe_sel_count = 0;
 
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
 	auto keys_count = state.join_keys.size();
+
+	// select the keys that are in the min-max range and compute their position in the perfect hash table
 	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0; i < keys_count; i++) {
+		state.probe_sel_vec.set_index(i, i);
+	}
+	const auto in_range_count =
+	    ComputeSlots(state.join_keys.data, keys_count, state.probe_sel_vec, keys_count, state.slots.get());
+
+	// keeps track of how many probe keys have a match
+	idx_t probe_sel_count = 0;
+	for (idx_t i = 0; i < in_range_count; i++) {
+		const auto row_idx = state.probe_sel_vec.get_index(i);
+		const auto slot = state.slots[row_idx];
+		// check for matches in the build
+		if (bitmap_build_idx[slot]) {
+			state.build_sel_vec.set_index(probe_sel_count, slot);
+			state.probe_sel_vec.set_index(probe_sel_count++, row_idx);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -198,87 +263,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -346,7 +346,7 @@ public:
 	bool Scanning() const {
 		return lhs_scanner.get();
 	}
-	void BeginLeftScan(hash_t scan_bin);
+	void BeginLeftScan(hash_t scan_bin, idx_t block_idx, idx_t block_start);
 	bool NextLeft();
 	void EndScan();
 
@@ -370,6 +370,7 @@ public:
 
 	//	LHS scanning
 	SelectionVector lhs_sel;
+	idx_t left_base;
 	optional_ptr<PartitionGlobalHashGroup> left_hash;
 	OuterJoinMarker left_outer;
 	unique_ptr<SBIterator> left_itr;
@@ -390,7 +391,7 @@ public:
 AsOfProbeBuffer::AsOfProbeBuffer(ClientContext &context, const PhysicalAsOfJoin &op)
     : context(context), allocator(Allocator::Get(context)), op(op),
       buffer_manager(BufferManager::GetBufferManager(context)), force_external(IsExternal(context)),
-      memory_per_thread(op.GetMaxThreadMemory(context)), left_outer(IsLeftOuterJoin(op.join_type)),
+      memory_per_thread(op.GetMaxThreadMemory(context)), left_base(0), left_outer(IsLeftOuterJoin(op.join_type)),
       fetch_next_left(true) {
 	vector<unique_ptr<BaseStatistics>> partition_stats;
 	Orders partitions; // Not used.
@@ -405,7 +406,7 @@ AsOfProbeBuffer::AsOfProbeBuffer(ClientContext &context, const PhysicalAsOfJoin
 	left_outer.Initialize(STANDARD_VECTOR_SIZE);
 }
 
-void AsOfProbeBuffer::BeginLeftScan(hash_t scan_bin) {
+void AsOfProbeBuffer::BeginLeftScan(hash_t scan_bin, idx_t block_idx, idx_t block_start) {
 	auto &gsink = op.sink_state->Cast<AsOfGlobalSinkState>();
 	auto &lhs_sink = *gsink.lhs_sink;
 	const auto left_group = lhs_sink.bin_groups[scan_bin];
@@ -436,11 +437,16 @@ void AsOfProbeBuffer::BeginLeftScan(hash_t scan_bin) {
 	if (left_sort.sorted_blocks.empty()) {
 		return;
 	}
-	lhs_scanner = make_uniq<PayloadScanner>(left_sort, false);
-	left_itr = make_uniq<SBIterator>(left_sort, iterator_comp);
+	//	We only scan a single payload block, so other threads can probe the rest of the bin.
+	//	The block is flushed as we go because no other thread will read it.
+	left_base = block_start;
+	lhs_scanner = make_uniq<PayloadScanner>(left_sort, block_idx, true);
+	left_itr = make_uniq<SBIterator>(left_sort, iterator_comp, left_base);
 
 	// We are only probing the corresponding right side bin, which may be empty
 	// If they are empty, we leave the iterator as null so we can emit left matches
+	// The right iterator starts at the beginning of the bin and the exponential search
+	// in ResolveJoin skips ahead to the first match of the block.
 	auto &rhs_sink = gsink.rhs_sink;
 	const auto right_group = rhs_sink.bin_groups[scan_bin];
 	if (right_group < rhs_sink.bin_groups.size()) {
@@ -459,7 +465,7 @@ bool AsOfProbeBuffer::NextLeft() {
 
 	//	Scan the next sorted chunk
 	lhs_payload.Reset();
-	left_itr->SetIndex(lhs_scanner->Scanned());
+	left_itr->SetIndex(left_base + lhs_scanner->Scanned());
 	lhs_scanner->Scan(lhs_payload);
 
 	return true;
@@ -474,6 +480,7 @@ void AsOfProbeBuffer::EndScan() {
 	left_hash = nullptr;
 	left_itr.reset();
 	lhs_scanner.reset();
+	left_base = 0;
 }
 
 void AsOfProbeBuffer::ResolveJoin(bool *found_match, idx_t *matches) {
@@ -638,8 +645,17 @@ void AsOfProbeBuffer::GetData(ExecutionContext &context, DataChunk &chunk) {
 
 class AsOfGlobalSourceState : public GlobalSourceState {
 public:
+	//! A block of the sorted left side of a hash bin that can be probed independently
+	struct LeftScanTask {
+		idx_t hash_bin;
+		idx_t block_idx;
+		//! The row number of the first row of the block in the sorted bin
+		idx_t block_start;
+	};
+
 	explicit AsOfGlobalSourceState(AsOfGlobalSinkState &gsink_p)
-	    : gsink(gsink_p), next_combine(0), combined(0), merged(0), mergers(0), next_left(0), flushed(0), next_right(0) {
+	    : gsink(gsink_p), next_combine(0), combined(0), merged(0), mergers(0), left_tasks_ready(false), next_left(0),
+	      flushed(0), next_right(0) {
 	}
 
 	PartitionGlobalMergeStates &GetMergeStates() {
@@ -650,6 +666,9 @@ public:
 		return *merge_states;
 	}
 
+	//! Split the sorted left bins into blocks so all threads can probe, even when there is a single bin
+	idx_t InitializeLeftTasks();
+
 	AsOfGlobalSinkState &gsink;
 	//! The next buffer to combine
 	atomic<size_t> next_combine;
@@ -659,9 +678,12 @@ public:
 	atomic<size_t> merged;
 	//! The number of combined buffers
 	atomic<size_t> mergers;
-	//! The next buffer to flush
+	//! The left blocks to probe
+	vector<LeftScanTask> left_tasks;
+	atomic<bool> left_tasks_ready;
+	//! The next left block to flush
 	atomic<size_t> next_left;
-	//! The number of flushed buffers
+	//! The number of flushed left blocks
 	atomic<size_t> flushed;
 	//! The right outer output read position.
 	atomic<idx_t> next_right;
@@ -675,6 +697,39 @@ public:
 	}
 };
 
+idx_t AsOfGlobalSourceState::InitializeLeftTasks() {
+	if (left_tasks_ready) {
+		return left_tasks.size();
+	}
+
+	lock_guard<mutex> guard(lock);
+	if (left_tasks_ready) {
+		return left_tasks.size();
+	}
+
+	auto &lhs_sink = *gsink.lhs_sink;
+	const auto left_bins = lhs_sink.grouping_data ? lhs_sink.grouping_data->GetPartitions().size() : 1;
+	for (idx_t hash_bin = 0; hash_bin < left_bins; ++hash_bin) {
+		const auto left_group = lhs_sink.bin_groups[hash_bin];
+		if (left_group >= lhs_sink.bin_groups.size()) {
+			continue;
+		}
+		auto &left_sort = *lhs_sink.hash_groups[left_group]->global_sort;
+		if (left_sort.sorted_blocks.empty()) {
+			continue;
+		}
+		idx_t block_start = 0;
+		auto &data_blocks = left_sort.sorted_blocks[0]->payload_data->data_blocks;
+		for (idx_t block_idx = 0; block_idx < data_blocks.size(); ++block_idx) {
+			left_tasks.push_back({hash_bin, block_idx, block_start});
+			block_start += data_blocks[block_idx]->count;
+		}
+	}
+	left_tasks_ready = true;
+
+	return left_tasks.size();
+}
+
 unique_ptr<GlobalSourceState> PhysicalAsOfJoin::GetGlobalSourceState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<AsOfGlobalSinkState>();
 	return make_uniq<AsOfGlobalSourceState>(gsink);
@@ -775,16 +830,16 @@ SourceResultType PhysicalAsOfJoin::GetData(ExecutionContext &context, DataChunk
 		return SourceResultType::FINISHED;
 	}
 
-	//	Step 3: Join the partitions
-	auto &lhs_sink = *gsource.gsink.lhs_sink;
-	const auto left_bins = lhs_sink.grouping_data ? lhs_sink.grouping_data->GetPartitions().size() : 1;
-	while (gsource.flushed < left_bins) {
+	//	Step 3: Join the partitions, one sorted left block at a time
+	const auto left_tasks = gsource.InitializeLeftTasks();
+	while (gsource.flushed < left_tasks) {
 		//	Make sure we have something to flush
 		if (!lsource.probe_buffer.Scanning()) {
-			const auto left_bin = gsource.next_left++;
-			if (left_bin < left_bins) {
+			const auto left_task = gsource.next_left++;
+			if (left_task < left_tasks) {
 				//	More to flush
-				lsource.probe_buffer.BeginLeftScan(left_bin);
+				const auto &task = gsource.left_tasks[left_task];
+				lsource.probe_buffer.BeginLeftScan(task.hash_bin, task.block_idx, task.block_start);
 			} else if (!IsRightOuterJoin(join_type) || client.interrupted) {
 				return SourceResultType::FINISHED;
 			} else {
@@ -7,6 +7,7 @@
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/interrupt.hpp"
@@ -611,6 +612,18 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	auto feedback = context.GetCardinalityFeedback();
+	if (feedback) {
+		auto build_size = ht.Count();
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_size += local_ht->Count();
+		}
+		if (feedback->Observe(build_table_indexes, children[1]->estimated_cardinality, build_size)) {
+			// the build side is far off from its estimate: abort execution so the query is planned again
+			throw InterruptException();
+		}
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -655,9 +668,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(ht.equality_types);
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
@@ -1261,8 +1272,19 @@ InsertionOrderPreservingMap<string> PhysicalHashJoin::ParamsToString() const {
 
 	if (perfect_join_statistics.is_build_small) {
 		// perfect hash join
-		result["Build Min"] = perfect_join_statistics.build_min.ToString();
-		result["Build Max"] = perfect_join_statistics.build_max.ToString();
+		string build_min;
+		string build_max;
+		for (idx_t key_idx = 0; key_idx < perfect_join_statistics.keys.size(); key_idx++) {
+			auto &key_stats = perfect_join_statistics.keys[key_idx];
+			if (key_idx > 0) {
+				build_min += ", ";
+				build_max += ", ";
+			}
+			build_min += key_stats.build_min.ToString();
+			build_max += key_stats.build_max.ToString();
+		}
+		result["Build Min"] = build_min;
+		result["Build Max"] = build_max;
 	}
 	result["Estimated Cardinality"] = StringUtil::Format("%llu", estimated_cardinality);
 	return result;
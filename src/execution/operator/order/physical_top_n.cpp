@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduce the heap to the top-n, returns true if the heap was reduced (and the boundary values were updated)
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,6 +410,8 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+	//! The tightest boundary value of the first order column over all threads (pushed into the dynamic filter)
+	Value boundary_value;
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -424,6 +429,10 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// clear the boundary of a previous execution of this operator (e.g., a prepared statement or a cached plan)
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,10 +443,35 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		auto &gstate = input.global_state.Cast<TopNGlobalState>();
+		UpdateDynamicFilter(gstate, sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalTopN::UpdateDynamicFilter(TopNGlobalState &gstate, TopNHeap &heap) const {
+	if (!heap.has_boundary_values) {
+		return;
+	}
+	// every row in the local heap is at least as good as the local boundary value, so the global top-n cannot
+	// contain any row with a worse value in the first order column: push the boundary into the scan
+	auto new_value = heap.boundary_values.GetValue(0, 0);
+	if (new_value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> glock(gstate.lock);
+	if (!gstate.boundary_value.IsNull()) {
+		bool is_tighter = orders[0].type == OrderType::ASCENDING ? new_value < gstate.boundary_value
+		                                                          : new_value > gstate.boundary_value;
+		if (!is_tighter) {
+			return;
+		}
+	}
+	gstate.boundary_value = new_value;
+	dynamic_filter->SetValue(std::move(new_value));
+}
+
 //===--------------------------------------------------------------------===//
 // Combine
 //===--------------------------------------------------------------------===//
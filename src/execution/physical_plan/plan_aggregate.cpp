@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -149,11 +150,30 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+static bool CanUseStreamingAggregate(LogicalAggregate &op, PhysicalOperator &child) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (op.grouping_sets.size() == 1 && op.grouping_sets[0].size() != op.groups.size()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || !aggregate.function.combine) {
+			return false;
+		}
+	}
+	// the rows of each group must be adjacent in the input
+	return PhysicalStreamingAggregate::CanStreamGroups(child, op.groups);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
+	// check the order of the input before the aggregate expressions are extracted
+	const auto streaming_groups = !op.groups.empty() && CanUseStreamingAggregate(op, *plan);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
 
@@ -178,9 +198,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// use a streaming aggregate if the input is ordered on the groups, or a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (streaming_groups) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    context, op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
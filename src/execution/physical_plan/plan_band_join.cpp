@@ -0,0 +1,285 @@
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_unnest.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_unnest_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Band Buckets
+//===--------------------------------------------------------------------===//
+// A band join has the conditions L >= R + lo AND L <= R + hi (or their strict versions).
+// This is equivalent to R + lo BETWEEN L - width AND L with width = hi - lo,
+// so if we cut the domain into buckets of the band width, every match of L lies in
+// the bucket of R + lo or in the next one. We insert each build row into both buckets
+// and probe the hash table with the bucket of L, keeping the band conditions as predicates.
+struct BandJoinBucketOperator {
+	template <class TA, class TB, class TR>
+	static inline TR Operation(TA input, TB width) {
+		// Floor division, so that all buckets have the same width
+		const auto value = static_cast<int64_t>(input);
+		auto bucket = value / width;
+		if (value % width != 0 && value < 0) {
+			--bucket;
+		}
+		return bucket;
+	}
+};
+
+template <class T>
+static void BandJoinBucketFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteStandard<T, int64_t, int64_t, BandJoinBucketOperator>(args.data[0], args.data[1], result,
+	                                                                             args.size());
+}
+
+template <class T>
+static void BandJoinBucketsFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	const auto count = args.size();
+	Vector buckets(LogicalType::BIGINT);
+	BandJoinBucketFunction<T>(args, state, buckets);
+
+	UnifiedVectorFormat bucket_data;
+	buckets.ToUnifiedFormat(count, bucket_data);
+	auto bucket_values = UnifiedVectorFormat::GetData<int64_t>(bucket_data);
+
+	// Every row is inserted into its own bucket and the next one
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	ListVector::Reserve(result, 2 * count);
+	auto list_entries = FlatVector::GetData<list_entry_t>(result);
+	auto &result_mask = FlatVector::Validity(result);
+	auto child_data = FlatVector::GetData<int64_t>(ListVector::GetEntry(result));
+	idx_t offset = 0;
+	for (idx_t i = 0; i < count; ++i) {
+		const auto idx = bucket_data.sel->get_index(i);
+		if (!bucket_data.validity.RowIsValid(idx)) {
+			list_entries[i] = list_entry_t(offset, 0);
+			result_mask.SetInvalid(i);
+			continue;
+		}
+		child_data[offset] = bucket_values[idx];
+		child_data[offset + 1] = bucket_values[idx] + 1;
+		list_entries[i] = list_entry_t(offset, 2);
+		offset += 2;
+	}
+	ListVector::SetListSize(result, offset);
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+template <bool BUCKETS>
+static scalar_function_t GetBandJoinBucketFunction(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		return BUCKETS ? BandJoinBucketsFunction<int8_t> : BandJoinBucketFunction<int8_t>;
+	case PhysicalType::INT16:
+		return BUCKETS ? BandJoinBucketsFunction<int16_t> : BandJoinBucketFunction<int16_t>;
+	case PhysicalType::INT32:
+		return BUCKETS ? BandJoinBucketsFunction<int32_t> : BandJoinBucketFunction<int32_t>;
+	case PhysicalType::INT64:
+		return BUCKETS ? BandJoinBucketsFunction<int64_t> : BandJoinBucketFunction<int64_t>;
+	case PhysicalType::UINT8:
+		return BUCKETS ? BandJoinBucketsFunction<uint8_t> : BandJoinBucketFunction<uint8_t>;
+	case PhysicalType::UINT16:
+		return BUCKETS ? BandJoinBucketsFunction<uint16_t> : BandJoinBucketFunction<uint16_t>;
+	case PhysicalType::UINT32:
+		return BUCKETS ? BandJoinBucketsFunction<uint32_t> : BandJoinBucketFunction<uint32_t>;
+	default:
+		throw InternalException("Unsupported type for band join");
+	}
+}
+
+static unique_ptr<Expression> CreateBandJoinBucket(unique_ptr<Expression> input, int64_t width, bool buckets) {
+	const auto input_type = input->return_type;
+	const auto return_type = buckets ? LogicalType::LIST(LogicalType::BIGINT) : LogicalType::BIGINT;
+	ScalarFunction bound_function(buckets ? "band_join_buckets" : "band_join_bucket",
+	                              {input_type, LogicalType::BIGINT}, return_type,
+	                              buckets ? GetBandJoinBucketFunction<true>(input_type)
+	                                      : GetBandJoinBucketFunction<false>(input_type));
+	vector<unique_ptr<Expression>> arguments;
+	arguments.emplace_back(std::move(input));
+	arguments.emplace_back(make_uniq<BoundConstantExpression>(Value::BIGINT(width)));
+	return make_uniq<BoundFunctionExpression>(return_type, std::move(bound_function), std::move(arguments), nullptr);
+}
+
+//===--------------------------------------------------------------------===//
+// Band Detection
+//===--------------------------------------------------------------------===//
+static bool IsBandJoinType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::DATE:
+	// Intervals without months are a fixed number of microseconds for naive timestamps
+	case LogicalTypeId::TIMESTAMP:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool GetBandOffset(const LogicalType &type, const Value &constant, int64_t &offset) {
+	if (constant.IsNull()) {
+		return false;
+	}
+	if (type.id() == LogicalTypeId::TIMESTAMP) {
+		if (constant.type().id() != LogicalTypeId::INTERVAL) {
+			return false;
+		}
+		const auto interval = IntervalValue::Get(constant);
+		int64_t day_micros;
+		if (interval.months != 0 ||
+		    !TryMultiplyOperator::Operation<int64_t, int64_t, int64_t>(interval.days, Interval::MICROS_PER_DAY,
+		                                                               day_micros)) {
+			return false;
+		}
+		return TryAddOperator::Operation<int64_t, int64_t, int64_t>(day_micros, interval.micros, offset);
+	}
+	if (!constant.type().IsIntegral()) {
+		return false;
+	}
+	Value bigint_value;
+	string error;
+	if (!constant.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, &error)) {
+		return false;
+	}
+	offset = BigIntValue::Get(bigint_value);
+	return true;
+}
+
+//! Splits an expression into R + offset for a constant offset
+static const Expression &GetBandBound(const Expression &expr, int64_t &offset) {
+	offset = 0;
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return expr;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.size() != 2 || func.children[1]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return expr;
+	}
+	const auto &constant = func.children[1]->Cast<BoundConstantExpression>().value;
+	int64_t value;
+	if (!GetBandOffset(expr.return_type, constant, value)) {
+		return expr;
+	}
+	if (func.function.name == "+") {
+		offset = value;
+		return *func.children[0];
+	}
+	if (func.function.name == "-" && value != NumericLimits<int64_t>::Minimum()) {
+		offset = -value;
+		return *func.children[0];
+	}
+	return expr;
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanBandJoin(LogicalComparisonJoin &op,
+                                                                 unique_ptr<PhysicalOperator> &left,
+                                                                 unique_ptr<PhysicalOperator> &right) {
+	if (op.join_type != JoinType::INNER) {
+		return nullptr;
+	}
+
+	//	Look for L >= R + lo and L <= R + hi
+	optional_idx lower_idx;
+	optional_idx upper_idx;
+	int64_t lo = 0;
+	int64_t hi = 0;
+	for (idx_t lower = 0; lower < op.conditions.size() && !lower_idx.IsValid(); ++lower) {
+		auto &lower_cond = op.conditions[lower];
+		if (lower_cond.comparison != ExpressionType::COMPARE_GREATERTHAN &&
+		    lower_cond.comparison != ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+			continue;
+		}
+		if (!IsBandJoinType(lower_cond.left->return_type)) {
+			continue;
+		}
+		int64_t lower_offset;
+		auto &lower_bound = GetBandBound(*lower_cond.right, lower_offset);
+		for (idx_t upper = 0; upper < op.conditions.size(); ++upper) {
+			auto &upper_cond = op.conditions[upper];
+			if (upper_cond.comparison != ExpressionType::COMPARE_LESSTHAN &&
+			    upper_cond.comparison != ExpressionType::COMPARE_LESSTHANOREQUALTO) {
+				continue;
+			}
+			if (!lower_cond.left->Equals(*upper_cond.left)) {
+				continue;
+			}
+			int64_t upper_offset;
+			auto &upper_bound = GetBandBound(*upper_cond.right, upper_offset);
+			if (!lower_bound.Equals(upper_bound) || upper_offset < lower_offset) {
+				continue;
+			}
+			lower_idx = lower;
+			upper_idx = upper;
+			lo = lower_offset;
+			hi = upper_offset;
+			break;
+		}
+	}
+	if (!lower_idx.IsValid()) {
+		return nullptr;
+	}
+
+	//	The bucket width must be positive, and wider buckets are still correct
+	int64_t width;
+	if (!TrySubtractOperator::Operation(hi, lo, width)) {
+		return nullptr;
+	}
+	width = MaxValue<int64_t>(width, 2);
+
+	//	Build side: insert each row into the buckets of R + lo and R + lo + width
+	const auto right_count = right->types.size();
+	auto &lower_cond = op.conditions[lower_idx.GetIndex()];
+	auto build_buckets = make_uniq<BoundUnnestExpression>(LogicalType::BIGINT);
+	build_buckets->child = CreateBandJoinBucket(lower_cond.right->Copy(), width, true);
+	vector<unique_ptr<Expression>> select_list;
+	select_list.push_back(std::move(build_buckets));
+	auto unnest_types = right->types;
+	unnest_types.push_back(LogicalType::BIGINT);
+	auto unnest = make_uniq<PhysicalUnnest>(std::move(unnest_types), std::move(select_list),
+	                                        right->estimated_cardinality * 2);
+	unnest->children.push_back(std::move(right));
+
+	//	Probe side: the bucket of L
+	vector<JoinCondition> conditions;
+	JoinCondition bucket_cond;
+	bucket_cond.left = CreateBandJoinBucket(lower_cond.left->Copy(), width, false);
+	bucket_cond.right = make_uniq<BoundReferenceExpression>(LogicalType::BIGINT, right_count);
+	bucket_cond.comparison = ExpressionType::COMPARE_EQUAL;
+	conditions.push_back(std::move(bucket_cond));
+	for (auto &cond : op.conditions) {
+		conditions.push_back(std::move(cond));
+	}
+	op.conditions.clear();
+
+	//	Do not emit the bucket column
+	auto right_projection_map = op.right_projection_map;
+	if (right_projection_map.empty()) {
+		for (idx_t i = 0; i < right_count; ++i) {
+			right_projection_map.push_back(i);
+		}
+	}
+
+	return make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(unnest), std::move(conditions), op.join_type,
+	                                   op.left_projection_map, right_projection_map, vector<LogicalType>(),
+	                                   op.estimated_cardinality, PerfectHashJoinStats(), nullptr);
+}
+
+} // namespace duckdb
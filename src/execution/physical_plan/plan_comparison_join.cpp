@@ -8,8 +8,10 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -21,6 +23,15 @@ namespace duckdb {
 bool ExtractNumericValue(Value val, int64_t &result) {
 	if (!val.type().IsIntegral()) {
 		switch (val.type().InternalType()) {
+		case PhysicalType::UINT8:
+			result = val.GetValueUnsafe<uint8_t>();
+			break;
+		case PhysicalType::UINT16:
+			result = val.GetValueUnsafe<uint16_t>();
+			break;
+		case PhysicalType::UINT32:
+			result = val.GetValueUnsafe<uint32_t>();
+			break;
 		case PhysicalType::INT16:
 			result = val.GetValueUnsafe<int16_t>();
 			break;
@@ -47,12 +58,8 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != 2 * op.conditions.size()) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -71,9 +78,9 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 			return;
 		}
 	}
-	// with integral internal types
+	// with integral internal types (this includes e.g. DATE and ENUM keys)
 	for (auto &&join_stat : op.join_stats) {
-		if (!TypeIsInteger(join_stat->GetType().InternalType()) ||
+		if (!join_stat || !TypeIsInteger(join_stat->GetType().InternalType()) ||
 		    join_stat->GetType().InternalType() == PhysicalType::INT128 ||
 		    join_stat->GetType().InternalType() == PhysicalType::UINT128) {
 			// perfect join not possible for non-integral types or hugeint
@@ -81,48 +88,56 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
-	}
-	if (max_value < min_value) {
-		// empty table
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
+	// The max size our build must have to run the perfect HJ
+	const idx_t MAX_BUILD_SIZE = 1000000;
+	// the domain of a composite key is the product of the domains of its keys
+	idx_t build_size = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		auto &stats_probe = *op.join_stats[2 * cond_idx];     // lhs stats
+		auto &stats_build = *op.join_stats[2 * cond_idx + 1]; // rhs stats
+		// and when the build range is smaller than the threshold
+		if (!NumericStats::HasMinMax(stats_build)) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
+		    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
+			return;
+		}
+		if (max_value < min_value) {
+			// empty table
+			return;
+		}
+		int64_t build_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
+			return;
+		}
+		if (!TryMultiplyOperator::Operation(build_size, NumericCast<idx_t>(build_range) + 1, build_size) ||
+		    build_size > MAX_BUILD_SIZE + 1) {
+			return;
+		}
 
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
+		// Fill join_stats for invisible join
+		if (!NumericStats::HasMinMax(stats_probe)) {
+			return;
+		}
+		PerfectHashJoinKeyStats key_stats;
+		key_stats.probe_min = NumericStats::Min(stats_probe);
+		key_stats.probe_max = NumericStats::Max(stats_probe);
+		key_stats.build_min = NumericStats::Min(stats_build);
+		key_stats.build_max = NumericStats::Max(stats_build);
+		key_stats.build_range = NumericCast<idx_t>(build_range);
+		if (!(key_stats.build_min <= key_stats.probe_min && key_stats.probe_max <= key_stats.build_max)) {
+			is_probe_in_domain = false;
+		}
+		join_state.keys.push_back(std::move(key_stats));
 	}
 
-	// The max size our build must have to run the perfect HJ
-	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
 	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = NumericCast<idx_t>(build_range);
-	if (join_state.build_range > MAX_BUILD_SIZE) {
-		return;
-	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
-	}
+	join_state.build_range = build_size - 1;
+	join_state.is_probe_in_domain = is_probe_in_domain;
 	join_state.is_build_small = true;
-	return;
 }
 
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
@@ -202,6 +217,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		    make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions), op.join_type,
 		                                op.left_projection_map, op.right_projection_map, std::move(op.mark_types),
 		                                op.estimated_cardinality, perfect_join_stats, std::move(op.filter_pushdown));
+		plan->Cast<PhysicalHashJoin>().build_table_indexes = CardinalityFeedback::GetLeafTableIndexes(*op.children[1]);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
@@ -209,6 +225,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 			can_iejoin = false;
 			can_merge = false;
 		}
+		if (can_merge && !client_config.prefer_range_joins) {
+			// narrow band joins can be evaluated as a hash join on buckets of the band width
+			plan = PlanBandJoin(op, left, right);
+			if (plan) {
+				return plan;
+			}
+		}
 		if (can_merge && can_iejoin) {
 			if (left->estimated_cardinality <= client_config.merge_join_threshold ||
 			    right->estimated_cardinality <= client_config.merge_join_threshold) {
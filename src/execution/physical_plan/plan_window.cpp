@@ -33,13 +33,30 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (enable_optimizer && PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx])) {
+		if (enable_optimizer &&
+		    PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx], *plan)) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
 		}
 	}
 
+	// The streaming windows are chained on top of the blocking ones, which don't preserve the order of the input.
+	// So streaming windows that rely on the input being sorted have to be blocking as well.
+	if (!blocking_windows.empty()) {
+		vector<idx_t> unordered_windows;
+		for (const auto &expr_idx : streaming_windows) {
+			auto &wexpr = op.expressions[expr_idx]->Cast<BoundWindowExpression>();
+			if (wexpr.orders.empty()) {
+				unordered_windows.push_back(expr_idx);
+			} else {
+				blocking_windows.push_back(expr_idx);
+			}
+		}
+		streaming_windows.swap(unordered_windows);
+		std::sort(blocking_windows.begin(), blocking_windows.end());
+	}
+
 	// Process the window functions by sharing the partition/order definitions
 	unordered_map<idx_t, idx_t> projection_map;
 	vector<vector<idx_t>> window_expressions;
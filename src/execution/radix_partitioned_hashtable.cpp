@@ -142,6 +142,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! Minimum number of tuples a thread must have sunk before we consider skipping lookups
+	static constexpr const idx_t SKIP_LOOKUP_THRESHOLD = 262144;
+	//! If more than this fraction of the sunk tuples created a new group, we skip lookups
+	static constexpr const double UNIQUE_PERCENTAGE_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -172,6 +177,8 @@ public:
 	const idx_t number_of_threads;
 	//! If any thread has called combine
 	atomic<bool> any_combined;
+	//! Whether the thread-local HTs skip lookups (pre-aggregation does not reduce the data)
+	atomic<bool> skip_lookups;
 
 	//! Lock for uncombined_data/stored_allocators
 	mutex lock;
@@ -197,8 +204,9 @@ RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const R
     : context(context_p), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
-      any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
-      count_before_combining(0), max_partition_size(0) {
+      any_combined(false), skip_lookups(false), finalize_done(0),
+      scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE), count_before_combining(0),
+      max_partition_size(0) {
 
 	// Compute minimum reservation
 	auto block_alloc_size = BufferManager::GetBufferManager(context).GetBlockAllocSize();
@@ -408,6 +416,8 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 			partitioned_data->Repartition(*lstate.abandoned_data);
 			ht.SetRadixBits(gstate.config.GetRadixBits());
 			ht.InitializePartitionedData();
+			// The abandoned groups no longer count towards the unique percentage
+			ht.ResetSinkCount();
 			return true;
 		}
 	}
@@ -451,6 +461,9 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		lstate.ht = CreateHT(context.client, gstate.config.sink_capacity, gstate.config.GetRadixBits());
 		gstate.active_threads++;
 	}
+	if (gstate.skip_lookups && !lstate.ht->SkipsLookups()) {
+		lstate.ht->SkipLookups();
+	}
 
 	auto &group_chunk = lstate.group_chunk;
 	PopulateGroupChunk(group_chunk, chunk);
@@ -465,9 +478,22 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+		if (!ht.SkipsLookups()) {
+			ht.ClearPointerTable();
+		}
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// If nearly every tuple creates a new group, the thread-local pre-aggregation is wasted effort:
+		// the groups are combined during Finalize anyway, so we stop probing and directly partition the tuples
+		const auto sink_count = ht.GetSinkCount();
+		if (!gstate.skip_lookups && !gstate.external && sink_count >= RadixHTConfig::SKIP_LOOKUP_THRESHOLD) {
+			const auto unique_percentage =
+			    static_cast<double>(ht.GetPartitionedData()->Count()) / static_cast<double>(sink_count);
+			if (unique_percentage > RadixHTConfig::UNIQUE_PERCENTAGE_THRESHOLD) {
+				gstate.skip_lookups = true;
+			}
+		}
 	}
 
 	// Check if we need to repartition
@@ -516,6 +542,11 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 	gstate.stored_allocators.emplace_back(ht.GetAggregateAllocator());
 }
 
+bool RadixPartitionedHashTable::SkippedLookups(GlobalSinkState &sink_p) {
+	auto &sink = sink_p.Cast<RadixHTGlobalSinkState>();
+	return sink.skip_lookups;
+}
+
 void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
 
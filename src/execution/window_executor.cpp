@@ -925,6 +925,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsRemovableAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
@@ -1020,6 +1021,37 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+bool WindowAggregateExecutorGlobalState::IsRemovableAggregate() {
+	const auto &wexpr = executor.wexpr;
+	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
+
+	if (!wexpr.aggregate || wexpr.children.empty()) {
+		return false;
+	}
+	// window exclusion splits the frame
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	Removing rows from the running state has to be exact (e.g., not floating point),
+	//	and the states are copied, so they can't own any memory.
+	const auto &function = AggregateObject(wexpr).function;
+	if (!function.remove || function.destructor) {
+		return false;
+	}
+
+	//	The running state is only reused when the frames overlap,
+	//	so boundaries that depend on the row would end up doing all the work of the naive aggregator.
+	if (wexpr.start_expr && !wexpr.start_expr->IsFoldable()) {
+		return false;
+	}
+	if (wexpr.end_expr && !wexpr.end_expr->IsFoldable()) {
+		return false;
+	}
+
+	return (mode < WindowAggregationMode::COMBINE);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
                               WindowExecutorGlobalState &gstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -1060,6 +1092,9 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsRemovableAggregate()) {
+		// slide a running state over the frames for invertible aggregates
+		aggregator = make_uniq<WindowRemovableAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -51,6 +51,17 @@ public:
 
 	//! Number of finalised states
 	std::atomic<idx_t> finalized;
+
+	ArenaAllocator &CreateTreeAllocator() {
+		lock_guard<mutex> tree_lock(lock);
+		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
+		return *tree_allocators.back();
+	}
+
+	//! The tree allocators.
+	//! We need to hold onto them for the tree lifetime,
+	//! not the lifetime of the local state that constructed part of the tree
+	vector<unique_ptr<ArenaAllocator>> tree_allocators;
 };
 
 WindowAggregator::WindowAggregator(AggregateObject aggr_p, const vector<LogicalType> &arg_types_p,
@@ -819,6 +830,258 @@ void WindowNaiveAggregator::Evaluate(const WindowAggregatorState &gsink, WindowA
 	lnstate.Evaluate(gnstate, bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowRemovableAggregator
+//===--------------------------------------------------------------------===//
+WindowRemovableAggregator::WindowRemovableAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                     const LogicalType &result_type,
+                                                     const WindowExcludeMode exclude_mode)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode) {
+	D_ASSERT(this->aggr.function.remove);
+	D_ASSERT(!this->aggr.function.destructor);
+}
+
+WindowRemovableAggregator::~WindowRemovableAggregator() {
+}
+
+class WindowRemovableAggregatorGlobalState : public WindowAggregatorGlobalState {
+public:
+	WindowRemovableAggregatorGlobalState(const WindowRemovableAggregator &aggregator, idx_t group_count)
+	    : WindowAggregatorGlobalState(aggregator, group_count), counted(false) {
+	}
+
+	void Finalize();
+
+	//! The number of rows in the frame that contribute to the aggregate
+	idx_t ContributingCount(idx_t begin, idx_t end) const {
+		if (contributing.empty()) {
+			return end - begin;
+		}
+		return contributing[end] - contributing[begin];
+	}
+
+	//! Whether the contributing rows have been counted
+	bool counted;
+	//! The number of rows before each row that pass the filter and are not NULL (empty if all rows contribute)
+	vector<idx_t> contributing;
+};
+
+void WindowRemovableAggregatorGlobalState::Finalize() {
+	lock_guard<mutex> count_guard(lock);
+	if (counted) {
+		return;
+	}
+	counted = true;
+
+	//	Removing values from a state can't restore the "no values" state (e.g., SUM returning NULL),
+	//	so we count the rows that actually update the state, and reset the states of frames without any.
+	const auto ignore_nulls = aggregator.aggr.function.null_handling == FunctionNullHandling::DEFAULT_NULL_HANDLING;
+	bool all_contributing = filter_mask.AllValid();
+	if (ignore_nulls) {
+		for (auto &input : inputs.data) {
+			all_contributing = all_contributing && FlatVector::Validity(input).AllValid();
+		}
+	}
+	if (all_contributing) {
+		return;
+	}
+
+	const auto count = inputs.size();
+	contributing.resize(count + 1);
+	contributing[0] = 0;
+	for (idx_t i = 0; i < count; ++i) {
+		bool contributes = filter_mask.RowIsValid(i);
+		if (ignore_nulls) {
+			for (auto &input : inputs.data) {
+				contributes = contributes && FlatVector::Validity(input).RowIsValid(i);
+			}
+		}
+		contributing[i + 1] = contributing[i] + contributes;
+	}
+}
+
+class WindowRemovableAggregatorState : public WindowAggregatorState {
+public:
+	explicit WindowRemovableAggregatorState(const WindowRemovableAggregator &aggregator);
+
+	void Evaluate(const WindowRemovableAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result,
+	              idx_t count, idx_t row_idx);
+
+protected:
+	//! Buffer the rows [begin, end) for adding to or removing from a state
+	void BufferRows(const WindowRemovableAggregatorGlobalState &gsink, data_ptr_t state_ptr, idx_t begin, idx_t end,
+	                bool removing);
+	//! Flush the buffered rows into their states
+	void FlushRows(const WindowRemovableAggregatorGlobalState &gsink, bool removing);
+
+	//! The aggregator we are working with
+	const WindowRemovableAggregator &aggregator;
+	//! The state of the frame of the last row evaluated
+	vector<data_t> running;
+	//! The frame of the running state (empty if there is none yet)
+	FrameBounds running_frame;
+	//! Data pointer that contains a vector of states, used for row aggregation
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Input data chunk, used for updating the states
+	DataChunk leaves;
+	//! The states and rows to add (0) and remove (1)
+	Vector statep[2];
+	SelectionVector update_sel[2];
+	idx_t flush_count[2];
+	//! The states to chain together
+	Vector statel;
+	Vector statet;
+};
+
+WindowRemovableAggregatorState::WindowRemovableAggregatorState(const WindowRemovableAggregator &aggregator_p)
+    : aggregator(aggregator_p), running(aggregator.state_size), running_frame(0, 0),
+      state(aggregator.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      statep {Vector(LogicalType::POINTER), Vector(LogicalType::POINTER)}, flush_count {0, 0},
+      statel(LogicalType::POINTER), statet(LogicalType::POINTER) {
+	update_sel[0].Initialize();
+	update_sel[1].Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+void WindowRemovableAggregatorState::FlushRows(const WindowRemovableAggregatorGlobalState &gsink, bool removing) {
+	auto &count = flush_count[removing];
+	if (!count) {
+		return;
+	}
+
+	leaves.Slice(gsink.inputs, update_sel[removing], count);
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto update = removing ? aggr.function.remove : aggr.function.update;
+	update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep[removing], count);
+
+	count = 0;
+}
+
+void WindowRemovableAggregatorState::BufferRows(const WindowRemovableAggregatorGlobalState &gsink,
+                                                data_ptr_t state_ptr, idx_t begin, idx_t end, bool removing) {
+	auto &filter_mask = gsink.filter_mask;
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep[removing]);
+	auto &sel = update_sel[removing];
+	auto &count = flush_count[removing];
+	for (auto f = begin; f < end; ++f) {
+		if (!filter_mask.RowIsValid(f)) {
+			continue;
+		}
+		pdata[count] = state_ptr;
+		sel.set_index(count++, f);
+		if (count >= STANDARD_VECTOR_SIZE) {
+			FlushRows(gsink, removing);
+		}
+	}
+}
+
+void WindowRemovableAggregatorState::Evaluate(const WindowRemovableAggregatorGlobalState &gsink,
+                                              const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) {
+	auto &aggr = aggregator.aggr;
+	auto &inputs = gsink.inputs;
+
+	if (leaves.ColumnCount() == 0 && inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	auto tdata = FlatVector::GetData<data_ptr_t>(statet);
+
+	//	Each row state starts out as the difference between its frame and the previous frame,
+	//	and the states are then chained together from the running state.
+	//	If the frames don't overlap enough, we start over from the frame instead.
+	idx_t nchain = 0;
+	data_ptr_t prev_state = running_frame.start < running_frame.end ? running.data() : nullptr;
+	auto prev = running_frame;
+	for (idx_t i = 0; i < count; ++i) {
+		auto state_ptr = fdata[i];
+		aggr.function.initialize(aggr.function, state_ptr);
+
+		const auto begin = begins[i];
+		const auto end = MaxValue(begins[i], ends[i]);
+		const auto lo = MaxValue(begin, prev.start);
+		const auto hi = MinValue(end, prev.end);
+		if (prev_state && lo < hi && (lo - prev.start) + (prev.end - hi) + (lo - begin) + (end - hi) < end - begin) {
+			BufferRows(gsink, state_ptr, prev.start, lo, true);
+			BufferRows(gsink, state_ptr, hi, prev.end, true);
+			BufferRows(gsink, state_ptr, begin, lo, false);
+			BufferRows(gsink, state_ptr, hi, end, false);
+			ldata[nchain] = prev_state;
+			tdata[nchain] = state_ptr;
+			++nchain;
+		} else {
+			BufferRows(gsink, state_ptr, begin, end, false);
+		}
+
+		prev_state = state_ptr;
+		prev = FrameBounds(begin, end);
+	}
+	FlushRows(gsink, false);
+	FlushRows(gsink, true);
+
+	//	Chain the states in order, so each one picks up the (already chained) previous one
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	if (nchain) {
+		aggr.function.combine(statel, statet, aggr_input_data, nchain);
+	}
+
+	//	Save the last state for the next chunk
+	if (count) {
+		memcpy(running.data(), fdata[count - 1], aggregator.state_size);
+		running_frame = prev;
+	}
+
+	//	Frames without any contributing rows return the empty value
+	for (idx_t i = 0; i < count; ++i) {
+		const auto begin = begins[i];
+		const auto end = MaxValue(begins[i], ends[i]);
+		if (!gsink.ContributingCount(begin, end)) {
+			aggr.function.initialize(aggr.function, fdata[i]);
+		}
+	}
+
+	//	Finalise the result aggregates and write to the result
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+}
+
+unique_ptr<WindowAggregatorState> WindowRemovableAggregator::GetGlobalState(idx_t group_count,
+                                                                            const ValidityMask &) const {
+	return make_uniq<WindowRemovableAggregatorGlobalState>(*this, group_count);
+}
+
+void WindowRemovableAggregator::Finalize(WindowAggregatorState &gstate, WindowAggregatorState &lstate,
+                                         const FrameStats &stats) {
+	gstate.Cast<WindowRemovableAggregatorGlobalState>().Finalize();
+}
+
+unique_ptr<WindowAggregatorState> WindowRemovableAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowRemovableAggregatorState>(*this);
+}
+
+void WindowRemovableAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                         const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &grstate = gsink.Cast<WindowRemovableAggregatorGlobalState>();
+	auto &lrstate = lstate.Cast<WindowRemovableAggregatorState>();
+	lrstate.Evaluate(grstate, bounds, result, count, row_idx);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
@@ -828,12 +1091,6 @@ public:
 
 	WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count);
 
-	ArenaAllocator &CreateTreeAllocator() {
-		lock_guard<mutex> tree_lock(lock);
-		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
-		return *tree_allocators.back();
-	}
-
 	//! The owning aggregator
 	const WindowSegmentTree &tree;
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
@@ -846,13 +1103,11 @@ public:
 	unique_ptr<AtomicCounters> build_started;
 	//! The number of entries completed so far at each level
 	unique_ptr<AtomicCounters> build_completed;
-	//! The tree allocators.
-	//! We need to hold onto them for the tree lifetime,
-	//! not the lifetime of the local state that constructed part of the tree
-	vector<unique_ptr<ArenaAllocator>> tree_allocators;
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of entries a thread builds at a time, so the updates fill a whole vector
+	static constexpr idx_t BUILD_BATCH = STANDARD_VECTOR_SIZE / TREE_FANOUT;
 };
 
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const vector<LogicalType> &arg_types,
@@ -1150,27 +1405,31 @@ void WindowSegmentTreeState::Finalize(WindowSegmentTreeGlobalState &gstate) {
 		}
 		const idx_t build_count = (level_size + gstate.TREE_FANOUT - 1) / gstate.TREE_FANOUT;
 
-		// Build the next fan-in
-		const idx_t build_idx = (*gstate.build_started).at(level_current)++;
-		if (build_idx >= build_count) {
+		// Claim the next batch of fan-ins
+		const idx_t build_begin = (*gstate.build_started).at(level_current).fetch_add(gstate.BUILD_BATCH);
+		if (build_begin >= build_count) {
 			//	Nothing left at this level, so wait until other threads are done.
-			//	Since we are only building TREE_FANOUT values at a time, this will be quick.
+			//	Since we are only building BUILD_BATCH values at a time, this will be quick.
 			while (level_current == gstate.build_level.load()) {
 				std::this_thread::sleep_for(std::chrono::milliseconds(1));
 			}
 			continue;
 		}
-
-		// compute the aggregate for this entry in the segment tree
-		const idx_t pos = build_idx * gstate.TREE_FANOUT;
-		const idx_t levels_flat_offset = levels_flat_start[level_current] + build_idx;
-		auto state_ptr = levels_flat_native.GetStatePtr(levels_flat_offset);
-		gtstate.WindowSegmentValue(gstate, level_current, pos, MinValue(level_size, pos + gstate.TREE_FANOUT),
-		                           state_ptr);
+		const idx_t build_end = MinValue(build_count, build_begin + gstate.BUILD_BATCH);
+
+		// compute the aggregates for these entries in the segment tree
+		// and flush them together so the update/combine calls process full vectors
+		for (idx_t build_idx = build_begin; build_idx < build_end; ++build_idx) {
+			const idx_t pos = build_idx * gstate.TREE_FANOUT;
+			const idx_t levels_flat_offset = levels_flat_start[level_current] + build_idx;
+			auto state_ptr = levels_flat_native.GetStatePtr(levels_flat_offset);
+			gtstate.WindowSegmentValue(gstate, level_current, pos, MinValue(level_size, pos + gstate.TREE_FANOUT),
+			                           state_ptr);
+		}
 		gtstate.FlushStates(level_current > 0);
 
-		//	If that was the last one, mark the level as complete.
-		const idx_t build_complete = ++(*gstate.build_completed).at(level_current);
+		//	If that was the last batch, mark the level as complete.
+		const idx_t build_complete = (*gstate.build_completed).at(level_current) += (build_end - build_begin);
 		if (build_complete == build_count) {
 			gstate.build_level++;
 			continue;
@@ -1563,8 +1822,32 @@ public:
 	// prev_idx, input_idx
 	using ZippedTuple = std::tuple<idx_t, idx_t>;
 	using ZippedElements = vector<ZippedTuple>;
+	using ZippedTree = MergeSortTree<ZippedTuple>;
 
 	DistinctSortTree(ZippedElements &&prev_idcs, WindowDistinctAggregatorGlobalState &gdsink);
+
+	//! Build the tree and its aggregate states.
+	//! Multiple threads can call this at the same time, and it returns when the tree is complete.
+	void Build();
+
+protected:
+	//! Build the aggregate states for the entries [begin, end) of a level
+	void BuildStates(idx_t level_nr, idx_t begin, idx_t end, ArenaAllocator &allocator);
+
+	//! The global state that holds the aggregate states
+	WindowDistinctAggregatorGlobalState &gdsink;
+	//! The tree of (prev_idx, input_idx) pairs
+	ZippedTree zipped_tree;
+	//! Whether the cascades have been moved out of the zipped tree
+	bool cascades_moved = false;
+	//! The first aggregate state task of each level (and the total number of tasks)
+	vector<idx_t> level_tasks;
+	//! The number of entries in each aggregate state task of a level
+	vector<idx_t> task_sizes;
+	//! The next aggregate state task to build
+	std::atomic<idx_t> next_task;
+	//! The number of aggregate state tasks that have been built
+	std::atomic<idx_t> completed_tasks;
 };
 
 void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
@@ -1645,16 +1928,91 @@ void WindowDistinctAggregatorGlobalState::Finalize(const FrameStats &stats) {
 }
 
 WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedElements &&prev_idcs,
-                                                                        WindowDistinctAggregatorGlobalState &gdsink) {
+                                                                        WindowDistinctAggregatorGlobalState &gdsink)
+    : gdsink(gdsink), next_task(0), completed_tasks(0) {
+	auto &levels_flat_native = gdsink.levels_flat_native;
+	auto &levels_flat_start = gdsink.levels_flat_start;
+
+	//	Set up the distinct value tree, which is built in parallel by Build
+	const auto count = prev_idcs.size();
+	zipped_tree.Allocate(std::move(prev_idcs));
+	const auto level_count = zipped_tree.tree.size();
+
+	// compute space required to store aggregation states of merge sort tree
+	// this is one aggregate state per entry per level
+	levels_flat_native.Initialize(count * level_count);
+	levels_flat_start.push_back(0);
+
+	//	Split the levels into tasks that are aligned on the runs.
+	//	The states of a run are chained, so the runs can't be split,
+	//	but we combine small runs so each task processes at least a vector.
+	tree.reserve(level_count);
+	idx_t level_width = 1;
+	idx_t task_count = 0;
+	for (idx_t level_nr = 0; level_nr < level_count; ++level_nr) {
+		tree.emplace_back(Elements(count), Offsets());
+		levels_flat_start.push_back(levels_flat_start.back() + count);
+
+		const auto task_size = level_width * MaxValue<idx_t>(STANDARD_VECTOR_SIZE / level_width, 1);
+		level_tasks.emplace_back(task_count);
+		task_sizes.emplace_back(task_size);
+		task_count += (count + task_size - 1) / task_size;
+		level_width *= FANOUT;
+	}
+	level_tasks.emplace_back(task_count);
+}
+
+void WindowDistinctAggregatorGlobalState::DistinctSortTree::Build() {
+	const auto task_count = level_tasks.back();
+	if (completed_tasks.load() >= task_count) {
+		return;
+	}
+
+	//	Build the distinct value tree
+	zipped_tree.Build();
+
+	//	The cascades of the tree are the same as the distinct value tree
+	{
+		lock_guard<mutex> build_guard(build_lock);
+		if (!cascades_moved) {
+			for (idx_t level_nr = 0; level_nr < tree.size(); ++level_nr) {
+				tree[level_nr].second = std::move(zipped_tree.tree[level_nr].second);
+			}
+			cascades_moved = true;
+		}
+	}
+
+	//	Walk the distinct value tree building the intermediate aggregates
+	optional_ptr<ArenaAllocator> allocator;
+	const auto count = zipped_tree.tree[0].first.size();
+	for (auto task_idx = next_task++; task_idx < task_count; task_idx = next_task++) {
+		if (!allocator) {
+			allocator = gdsink.CreateTreeAllocator();
+		}
+		const auto level_nr = idx_t(std::upper_bound(level_tasks.begin(), level_tasks.end(), task_idx) - 1 -
+		                            level_tasks.begin());
+		const auto begin = (task_idx - level_tasks[level_nr]) * task_sizes[level_nr];
+		const auto end = MinValue<idx_t>(count, begin + task_sizes[level_nr]);
+		BuildStates(level_nr, begin, end, *allocator);
+		++completed_tasks;
+	}
+
+	//	Wait until the other threads are done.
+	//	Since we are only building a vector of values at a time, this will be quick.
+	while (completed_tasks.load() < task_count) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+void WindowDistinctAggregatorGlobalState::DistinctSortTree::BuildStates(idx_t level_nr, idx_t begin, idx_t end,
+                                                                        ArenaAllocator &allocator) {
 	auto &aggr = gdsink.aggregator.aggr;
-	auto &allocator = gdsink.allocator;
 	auto &inputs = gdsink.inputs;
 	auto &levels_flat_native = gdsink.levels_flat_native;
-	auto &levels_flat_start = gdsink.levels_flat_start;
 
 	//! Input data chunk, used for leaf segment aggregation
 	DataChunk leaves;
-	leaves.Initialize(Allocator::DefaultAllocator(), gdsink.inputs.GetTypes());
+	leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
 	SelectionVector sel;
 	sel.Initialize();
 
@@ -1671,70 +2029,53 @@ WindowDistinctAggregatorGlobalState::DistinctSortTree::DistinctSortTree(ZippedEl
 	auto targets = FlatVector::GetData<data_ptr_t>(target_v);
 	idx_t ncombine = 0;
 
-	// compute space required to store aggregation states of merge sort tree
-	// this is one aggregate state per entry per level
-	MergeSortTree<ZippedTuple> zipped_tree(std::move(prev_idcs));
-	idx_t internal_nodes = 0;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		internal_nodes += zipped_tree.tree[level_nr].first.size();
-	}
-	levels_flat_native.Initialize(internal_nodes);
-	levels_flat_start.push_back(0);
-	idx_t levels_flat_offset = 0;
-
-	//	Walk the distinct value tree building the intermediate aggregates
-	tree.reserve(zipped_tree.tree.size());
+	const auto &zipped_level = zipped_tree.tree[level_nr].first;
+	auto &level = tree[level_nr].first;
 	idx_t level_width = 1;
-	for (idx_t level_nr = 0; level_nr < zipped_tree.tree.size(); ++level_nr) {
-		auto &zipped_level = zipped_tree.tree[level_nr].first;
-		vector<ElementType> level;
-		level.reserve(zipped_level.size());
-
-		for (idx_t i = 0; i < zipped_level.size(); i += level_width) {
-			//	Reset the combine state
-			data_ptr_t prev_state = nullptr;
-			auto next_limit = MinValue<idx_t>(zipped_level.size(), i + level_width);
-			for (auto j = i; j < next_limit; ++j) {
-				//	Initialise the next aggregate
-				auto curr_state = levels_flat_native.GetStatePtr(levels_flat_offset++);
-
-				//	Update this state (if it matches)
-				const auto prev_idx = std::get<0>(zipped_level[j]);
-				level.emplace_back(prev_idx);
-				if (prev_idx < i + 1) {
-					updates[nupdate] = curr_state;
-					//	input_idx
-					sel[nupdate] = UnsafeNumericCast<sel_t>(std::get<1>(zipped_level[j]));
-					++nupdate;
-				}
+	for (idx_t i = 0; i < level_nr; ++i) {
+		level_width *= FANOUT;
+	}
+	auto levels_flat_offset = gdsink.levels_flat_start[level_nr] + begin;
+
+	for (idx_t i = begin; i < end; i += level_width) {
+		//	Reset the combine state
+		data_ptr_t prev_state = nullptr;
+		auto next_limit = MinValue<idx_t>(end, i + level_width);
+		for (auto j = i; j < next_limit; ++j) {
+			//	Initialise the next aggregate
+			auto curr_state = levels_flat_native.GetStatePtr(levels_flat_offset++);
+
+			//	Update this state (if it matches)
+			const auto prev_idx = std::get<0>(zipped_level[j]);
+			level[j] = prev_idx;
+			if (prev_idx < i + 1) {
+				updates[nupdate] = curr_state;
+				//	input_idx
+				sel[nupdate] = UnsafeNumericCast<sel_t>(std::get<1>(zipped_level[j]));
+				++nupdate;
+			}
 
-				//	Merge the previous state (if any)
-				if (prev_state) {
-					sources[ncombine] = prev_state;
-					targets[ncombine] = curr_state;
-					++ncombine;
-				}
-				prev_state = curr_state;
-
-				//	Flush the states if one is maxed out.
-				if (MaxValue<idx_t>(ncombine, nupdate) >= STANDARD_VECTOR_SIZE) {
-					//	Push the updates first so they propagate
-					leaves.Reference(inputs);
-					leaves.Slice(sel, nupdate);
-					aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
-					nupdate = 0;
-
-					//	Combine the states sequentially
-					aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
-					ncombine = 0;
-				}
+			//	Merge the previous state (if any)
+			if (prev_state) {
+				sources[ncombine] = prev_state;
+				targets[ncombine] = curr_state;
+				++ncombine;
+			}
+			prev_state = curr_state;
+
+			//	Flush the states if one is maxed out.
+			if (MaxValue<idx_t>(ncombine, nupdate) >= STANDARD_VECTOR_SIZE) {
+				//	Push the updates first so they propagate
+				leaves.Reference(inputs);
+				leaves.Slice(sel, nupdate);
+				aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), update_v, nupdate);
+				nupdate = 0;
+
+				//	Combine the states sequentially
+				aggr.function.combine(source_v, target_v, aggr_input_data, ncombine);
+				ncombine = 0;
 			}
 		}
-
-		tree.emplace_back(std::move(level), std::move(zipped_tree.tree[level_nr].second));
-
-		levels_flat_start.push_back(levels_flat_offset);
-		level_width *= FANOUT;
 	}
 
 	//	Flush any remaining states
@@ -1769,6 +2110,9 @@ void WindowDistinctAggregatorLocalState::Evaluate(const WindowDistinctAggregator
 	auto ldata = FlatVector::GetData<const_data_ptr_t>(statel);
 	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
 
+	//	The threads that evaluate the partition build the tree together the first time through
+	gdstate.merge_sort_tree->Build();
+
 	const auto &merge_sort_tree = *gdstate.merge_sort_tree;
 	const auto &levels_flat_native = gdstate.levels_flat_native;
 	const auto exclude_mode = gdstate.aggregator.exclude_mode;
@@ -139,6 +139,20 @@ struct CountFunction : public BaseCountFunction {
 		}
 	}
 
+	static void CountRemove(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, Vector &states,
+	                        idx_t count) {
+		auto &input = inputs[0];
+		UnifiedVectorFormat idata, sdata;
+		input.ToUnifiedFormat(count, idata);
+		states.ToUnifiedFormat(count, sdata);
+		auto state_ptrs = reinterpret_cast<STATE **>(sdata.data);
+		for (idx_t i = 0; i < count; i++) {
+			if (idata.validity.RowIsValid(idata.sel->get_index(i))) {
+				*state_ptrs[sdata.sel->get_index(i)] -= 1;
+			}
+		}
+	}
+
 	static inline void CountFlatUpdateLoop(STATE &result, ValidityMask &mask, idx_t count) {
 		idx_t base_idx = 0;
 		auto entry_count = ValidityMask::EntryCount(count);
@@ -218,6 +232,7 @@ AggregateFunction CountFun::GetFunction() {
 	                      FunctionNullHandling::SPECIAL_HANDLING, CountFunction::CountUpdate);
 	fun.name = "count";
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	fun.remove = CountFunction::CountRemove;
 	return fun;
 }
 
@@ -6,6 +6,7 @@
 #include "duckdb/logging/http_logger.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -122,6 +123,17 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaCreateMaterializedViewTable(ClientContext &context, const FunctionParameters &parameters) {
+	MaterializedView::CreateTable(context, parameters.values[0].ToString(), parameters.values[1].ToString(),
+	                              parameters.values[2].ToString(), parameters.values[3].ToString());
+}
+
+static void PragmaRefreshMaterializedViewStatements(ClientContext &context, const FunctionParameters &parameters) {
+	MaterializedView::Refresh(context, parameters.values[0].ToString(), parameters.values[1].ToString(),
+	                          parameters.values[2].ToString(), parameters.values[3].GetValue<uint64_t>(),
+	                          parameters.values[4].ToString());
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -160,6 +172,15 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_checkpoint_on_shutdown", PragmaEnableCheckpointOnShutdown));
 	set.AddFunction(
 	    PragmaFunction::PragmaStatement("disable_checkpoint_on_shutdown", PragmaDisableCheckpointOnShutdown));
+
+	// used by the statements of PRAGMA create_materialized_view and PRAGMA refresh_materialized_view
+	set.AddFunction(PragmaFunction::PragmaCall(
+	    "__internal_create_materialized_view", PragmaCreateMaterializedViewTable,
+	    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}));
+	set.AddFunction(PragmaFunction::PragmaCall("__internal_refresh_materialized_view",
+	                                           PragmaRefreshMaterializedViewStatements,
+	                                           {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR,
+	                                            LogicalType::UBIGINT, LogicalType::VARCHAR}));
 }
 
 } // namespace duckdb
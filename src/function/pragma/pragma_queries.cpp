@@ -7,6 +7,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/parser/qualified_name.hpp"
 #include "duckdb/parser/statement/copy_statement.hpp"
@@ -201,6 +202,14 @@ string PragmaUserAgent(ClientContext &context, const FunctionParameters &paramet
 	return "SELECT * FROM pragma_user_agent()";
 }
 
+string PragmaCreateMaterializedView(ClientContext &context, const FunctionParameters &parameters) {
+	return MaterializedView::CreateQuery(context, parameters.values[0].ToString(), parameters.values[1].ToString());
+}
+
+string PragmaRefreshMaterializedView(ClientContext &context, const FunctionParameters &parameters) {
+	return MaterializedView::RefreshQuery(context, parameters.values[0].ToString());
+}
+
 void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("table_info", PragmaTableInfo, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaCall("storage_info", PragmaStorageInfo, {LogicalType::VARCHAR}));
@@ -221,6 +230,10 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	    PragmaFunction::PragmaCall("copy_database", PragmaCopyDatabase, {LogicalType::VARCHAR, LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("all_profiling_output", PragmaAllProfiling));
 	set.AddFunction(PragmaFunction::PragmaStatement("user_agent", PragmaUserAgent));
+	set.AddFunction(PragmaFunction::PragmaCall("create_materialized_view", PragmaCreateMaterializedView,
+	                                           {LogicalType::VARCHAR, LogicalType::VARCHAR}));
+	set.AddFunction(
+	    PragmaFunction::PragmaCall("refresh_materialized_view", PragmaRefreshMaterializedView, {LogicalType::VARCHAR}));
 }
 
 } // namespace duckdb
@@ -0,0 +1,76 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryAdmissionsData : public GlobalTableFunctionState {
+	DuckDBQueryAdmissionsData() : offset(0) {
+	}
+
+	vector<QueryAdmissionInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryAdmissionsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("estimated_memory");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("status");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("wait_time_ms");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryAdmissionsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryAdmissionsData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetQueryAdmissions();
+	return std::move(result);
+}
+
+void DuckDBQueryAdmissionsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryAdmissionsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query_id, BIGINT
+		output.SetValue(col++, count,
+		                entry.query_id.IsValid() ? Value::BIGINT(NumericCast<int64_t>(entry.query_id.GetIndex()))
+		                                         : Value());
+		// query, VARCHAR
+		output.SetValue(col++, count, entry.query);
+		// estimated_memory, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.estimated_memory)));
+		// status, VARCHAR
+		output.SetValue(col++, count, !entry.admitted ? "WAITING" : entry.timed_out ? "TIMED_OUT" : "ADMITTED");
+		// wait_time_ms, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.wait_time)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryAdmissionsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_admissions", {}, DuckDBQueryAdmissionsFunction,
+	                              DuckDBQueryAdmissionsBind, DuckDBQueryAdmissionsInit));
+}
+
+} // namespace duckdb
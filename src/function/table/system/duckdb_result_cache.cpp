@@ -0,0 +1,69 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBResultCacheData : public GlobalTableFunctionState {
+	DuckDBResultCacheData() : offset(0) {
+	}
+
+	vector<ResultCacheInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBResultCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBResultCacheData>();
+
+	result->entries = ResultCache::Get(context).GetEntries();
+	return std::move(result);
+}
+
+void DuckDBResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBResultCacheData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, entry.query);
+		// row_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.row_count)));
+		// memory_usage, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.memory_usage)));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_result_cache", {}, DuckDBResultCacheFunction, DuckDBResultCacheBind,
+	                              DuckDBResultCacheInit));
+}
+
+} // namespace duckdb
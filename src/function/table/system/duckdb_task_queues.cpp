@@ -0,0 +1,91 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBTaskQueuesData : public GlobalTableFunctionState {
+	DuckDBTaskQueuesData() : offset(0) {
+	}
+
+	vector<ProducerQueueStatus> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBTaskQueuesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("producer_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("query_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("priority");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("max_threads");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("pending_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("local_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("active_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("completed_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBTaskQueuesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBTaskQueuesData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetQueueStatus();
+	return std::move(result);
+}
+
+void DuckDBTaskQueuesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBTaskQueuesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// producer_id, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.producer_id)));
+		// query_id, BIGINT
+		output.SetValue(col++, count,
+		                entry.query_id.IsValid() ? Value::BIGINT(NumericCast<int64_t>(entry.query_id.GetIndex()))
+		                                         : Value());
+		// priority, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.priority)));
+		// max_threads, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.max_threads)));
+		// pending_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.pending_tasks)));
+		// local_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.local_tasks)));
+		// active_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.active_tasks)));
+		// completed_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.completed_tasks)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBTaskQueuesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_task_queues", {}, DuckDBTaskQueuesFunction, DuckDBTaskQueuesBind, DuckDBTaskQueuesInit));
+}
+
+} // namespace duckdb
@@ -272,6 +272,14 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+unique_ptr<NodeStatistics> IndexScanCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	// the index scan emits the rows whose row ids were found in the index, and the transaction-local rows
+	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
+	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
+	idx_t estimated_cardinality = bind_data.row_ids.size() + local_storage.AddedRows(bind_data.table.GetStorage());
+	return make_uniq<NodeStatistics>(estimated_cardinality, estimated_cardinality);
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -409,7 +417,7 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	scan_function.init_global = IndexScanInitGlobal;
 	scan_function.statistics = TableScanStatistics;
 	scan_function.dependency = TableScanDependency;
-	scan_function.cardinality = TableScanCardinality;
+	scan_function.cardinality = IndexScanCardinality;
 	scan_function.pushdown_complex_filter = nullptr;
 	scan_function.to_string = TableScanToString;
 	scan_function.table_scan_progress = nullptr;
@@ -6,6 +6,7 @@
 #include "duckdb/common/arrow/arrow_buffer.hpp"
 #include "duckdb/main/client_properties.hpp"
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/radix.hpp"
 
 namespace duckdb {
 
@@ -119,6 +120,18 @@ static void AppendValidity(ArrowAppendData &append_data, UnifiedVectorFormat &fo
 		// if all values are valid we don't need to do anything else
 		return;
 	}
+	if (from == 0 && append_data.row_count % 8 == 0 && !format.sel->IsSet() && Radix::IsLittleEndian()) {
+		// on little-endian hosts, a flat validity mask has the same bit layout as an Arrow validity buffer
+		auto validity_data = (uint8_t *)append_data.GetValidityBuffer().data() + append_data.row_count / 8;
+		auto byte_count = (size + 7) / 8;
+		memcpy(validity_data, format.validity.GetData(), byte_count);
+		if (size % 8 != 0) {
+			// the bits after the last row should be set, as the next append only unsets bits of NULL values
+			validity_data[byte_count - 1] |= static_cast<uint8_t>(0xFF << (size % 8));
+		}
+		append_data.null_count += size - format.validity.CountValid(size);
+		return;
+	}
 
 	// otherwise we iterate through the validity mask
 	auto validity_data = (uint8_t *)append_data.GetValidityBuffer().data();
@@ -75,6 +75,12 @@ struct ArrowScalarBaseData {
 		auto data = UnifiedVectorFormat::GetData<SRC>(format);
 		auto result_data = main_buffer.GetData<TGT>();
 
+		if (std::is_same<TGT, SRC>::value && std::is_same<OP, ArrowScalarConverter>::value && !format.sel->IsSet()) {
+			// the layout of a flat vector matches the Arrow layout: copy the values in bulk
+			memcpy(result_data + append_data.row_count, data + from, sizeof(TGT) * size);
+			append_data.row_count += size;
+			return;
+		}
 		for (idx_t i = from; i < to; i++) {
 			auto source_idx = format.sel->get_index(i);
 			auto result_idx = append_data.row_count + i - from;
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/arrow/physical_buffered_arrow_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+
+namespace duckdb {
+class ArrowBufferedData;
+
+class BufferedArrowCollectorLocalState : public LocalSinkState {
+public:
+	//! The appender for the record batch we are currently creating
+	unique_ptr<ArrowAppender> appender;
+	//! The size of the chunks that were appended to the current record batch
+	idx_t allocation_size = 0;
+	//! The batch index of the current record batch
+	idx_t current_batch = 0;
+};
+
+//! PhysicalBufferedArrowCollector streams the result of a query as Arrow record batches. The record batches are
+//! produced by the pipeline threads, and are handed to the consumer in order through an ArrowBufferedData.
+class PhysicalBufferedArrowCollector : public PhysicalResultCollector {
+public:
+	PhysicalBufferedArrowCollector(PreparedStatementData &data, bool parallel, bool use_batch_index, idx_t batch_size);
+
+public:
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data,
+	                                                  idx_t batch_size);
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return use_batch_index;
+	}
+	bool ParallelSink() const override {
+		return parallel;
+	}
+	bool SinkOrderDependent() const override {
+		return true;
+	}
+	bool IsStreaming() const override {
+		return true;
+	}
+
+public:
+	//! User provided batch size
+	idx_t record_batch_size;
+	bool parallel;
+	//! Whether or not the order of the record batches is determined by the batch index
+	bool use_batch_index;
+
+private:
+	//! Hands the record batch that is being created by the local state to the consumer
+	void FlushRecordBatch(ArrowBufferedData &buffered_data, BufferedArrowCollectorLocalState &lstate) const;
+};
+
+} // namespace duckdb
@@ -27,6 +27,7 @@ enum class PhysicalOperatorType : uint8_t {
 	UNGROUPED_AGGREGATE,
 	HASH_GROUP_BY,
 	PERFECT_HASH_GROUP_BY,
+	STREAMING_GROUP_BY,
 	FILTER,
 	PROJECTION,
 	COPY_TO_FILE,
@@ -22,6 +22,10 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	static constexpr idx_t MSD_RADIX_STRING_SORT_THRESHOLD = 4096;
+	//! Maximum number of sorted blocks that are merged at once (in-memory and external)
+	static constexpr idx_t MAXIMUM_MERGE_WAYS = 64;
+	static constexpr idx_t MAXIMUM_EXTERNAL_MERGE_WAYS = 4;
 };
 
 struct SortLayout {
@@ -91,11 +95,15 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
-	//! Progress in merge path stage
+	//! Number of sorted blocks that are merged together in the current round
+	idx_t merge_ways;
+	//! Progress in merge path stage (pair_idx/num_pairs index the groups of 'merge_ways' blocks)
 	idx_t pair_idx;
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+	//! Progress in each of the blocks of the current group (k-way merge path)
+	vector<idx_t> way_starts;
 };
 
 struct LocalSortState {
@@ -170,6 +178,17 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The readers and input blocks of a k-way merge
+	vector<unique_ptr<SBScanState>> way_readers;
+	vector<unique_ptr<SortedBlock>> way_inputs;
+	//! Number of rows that remain in each of the k-way inputs
+	vector<idx_t> way_remaining;
+	//! Tournament tree over the k-way readers (tree[1] holds the reader with the smallest tuple)
+	vector<idx_t> way_tree;
+	//! Saved reader indices (to restore after computing the merge)
+	vector<idx_t> way_block_idxs;
+	vector<idx_t> way_entry_idxs;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -177,6 +196,8 @@ private:
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+	//! Compare values within SortedBlocks using a global index (without using the progress of the merge)
+	int CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
@@ -202,6 +223,24 @@ private:
 	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
 	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
 	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+
+	//! Computes the slices of the blocks in the current group that will be merged next (k-way Merge Path partition)
+	void GetNextKWayPartition();
+	//! Finds the offsets in each of the blocks of the current group at which 'rank' tuples precede the boundary
+	void GetKWayIntersection(const idx_t rank, vector<idx_t> &splits);
+	//! Counts the tuples in [lo, hi) of reader 'way' that precede the tuple at index 'idx' of reader 'pivot'
+	idx_t CountPreceding(const idx_t way, const idx_t pivot, const idx_t idx, const idx_t lo, const idx_t hi);
+	//! Merges the k-way partition
+	void MergeKWayPartition();
+	//! Compares the next tuples of two k-way readers, returns the reader with the smallest one
+	idx_t KWayWinner(const idx_t l_way, const idx_t r_way);
+	//! Computes from which reader the next 'count' tuples should be taken by setting the 'sources' array
+	void ComputeKWayMerge(const idx_t &count, idx_t sources[]);
+	//! Merges the radix sorting blocks according to the 'sources' array
+	void MergeKWayRadix(const idx_t &count, const idx_t sources[]);
+	//! Merges SortedData according to the 'sources' array
+	void MergeKWayData(SortedData &result_data, SortedDataType type, const idx_t &count, const idx_t sources[],
+	                   bool reset_indices);
 };
 
 struct SBIterator {
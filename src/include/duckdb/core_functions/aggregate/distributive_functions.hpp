@@ -24,6 +24,33 @@ struct ApproxCountDistinctFun {
 	static AggregateFunction GetFunction();
 };
 
+struct ApproxCountDistinctStateFun {
+	static constexpr const char *Name = "approx_count_distinct_state";
+	static constexpr const char *Parameters = "any";
+	static constexpr const char *Description = "Computes a serialized HyperLogLog sketch of the elements, which can be merged with approx_count_distinct_merge and estimated with approx_count_distinct_estimate.";
+	static constexpr const char *Example = "approx_count_distinct_state(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ApproxCountDistinctMergeFun {
+	static constexpr const char *Name = "approx_count_distinct_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges serialized HyperLogLog sketches created by approx_count_distinct_state.";
+	static constexpr const char *Example = "approx_count_distinct_merge(sketch)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ApproxCountDistinctEstimateFun {
+	static constexpr const char *Name = "approx_count_distinct_estimate";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Returns the approximate count of distinct elements of a HyperLogLog sketch created by approx_count_distinct_state.";
+	static constexpr const char *Example = "approx_count_distinct_estimate(approx_count_distinct_state(A))";
+
+	static ScalarFunction GetFunction();
+};
+
 struct ArgMinFun {
 	static constexpr const char *Name = "arg_min";
 	static constexpr const char *Parameters = "arg,val";
@@ -24,6 +24,33 @@ struct ApproxQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct QuantileSketchFun {
+	static constexpr const char *Name = "quantile_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Computes a serialized T-Digest sketch of the values, which can be merged with quantile_sketch_merge and queried with quantile_sketch_estimate.";
+	static constexpr const char *Example = "quantile_sketch(x)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct QuantileSketchMergeFun {
+	static constexpr const char *Name = "quantile_sketch_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges serialized T-Digest sketches created by quantile_sketch.";
+	static constexpr const char *Example = "quantile_sketch_merge(sketch)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct QuantileSketchEstimateFun {
+	static constexpr const char *Name = "quantile_sketch_estimate";
+	static constexpr const char *Parameters = "sketch,pos";
+	static constexpr const char *Description = "Returns the approximate quantile of a T-Digest sketch created by quantile_sketch.";
+	static constexpr const char *Example = "quantile_sketch_estimate(quantile_sketch(x), 0.5)";
+
+	static ScalarFunction GetFunction();
+};
+
 struct MadFun {
 	static constexpr const char *Name = "mad";
 	static constexpr const char *Parameters = "x";
@@ -11,6 +11,7 @@
 #include "duckdb/core_functions/aggregate/quantile_helpers.hpp"
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/random_engine.hpp"
 #include <algorithm>
 #include <numeric>
 #include <stdlib.h>
@@ -223,6 +224,74 @@ struct Interpolator<true> {
 	idx_t end;
 };
 
+//	Sampled selection (Floyd-Rivest) for large buffers:
+//	Pick two pivots from a random sample that bracket the requested rank(s) with high probability,
+//	then partition the buffer around them in a single pass. If the ranks fall between the pivots,
+//	only the (small) middle partition needs to be searched by the interpolator.
+struct QuantileNarrow {
+	//! Buffers smaller than this are selected directly
+	static constexpr idx_t THRESHOLD = 65536;
+
+	template <class INPUT_TYPE, class INTERPOLATOR, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
+	static void Operation(INPUT_TYPE *v_t, INTERPOLATOR &interp, const ACCESSOR &accessor = ACCESSOR()) {
+		const auto begin = interp.begin;
+		const auto end = interp.end;
+		const auto n = end - begin;
+		if (n < THRESHOLD || interp.FRN < begin || interp.CRN >= end) {
+			return;
+		}
+
+		//	Draw a stratified sample of ~n^(2/3) elements
+		const auto s = MaxValue<idx_t>(LossyNumericCast<idx_t>(std::pow(double(n), 2.0 / 3.0)), 1);
+		const auto stride = n / s;
+		RandomEngine random(NumericCast<int64_t>(n));
+		vector<INPUT_TYPE> sample;
+		sample.reserve(s);
+		for (idx_t i = 0; i < s; ++i) {
+			const auto offset = random.NextRandomInteger(0, UnsafeNumericCast<uint32_t>(stride - 1));
+			sample.emplace_back(v_t[begin + i * stride + offset]);
+		}
+
+		//	Choose pivot ranks a few standard deviations around the scaled target ranks
+		QuantileCompare<ACCESSOR> comp(accessor, interp.desc);
+		const auto scale = double(s) / double(n);
+		const auto delta = LossyNumericCast<idx_t>(2 * std::sqrt(double(s))) + 1;
+		const auto lo_scaled = LossyNumericCast<idx_t>(double(interp.FRN - begin) * scale);
+		const auto hi_scaled = LossyNumericCast<idx_t>(double(interp.CRN - begin) * scale);
+		const bool has_lo = lo_scaled >= delta;
+		const bool has_hi = hi_scaled + delta < s;
+		if (!has_lo && !has_hi) {
+			return;
+		}
+		const auto lo_rank = has_lo ? lo_scaled - delta : 0;
+		const auto hi_rank = has_hi ? hi_scaled + delta : s - 1;
+		std::nth_element(sample.begin(), sample.begin() + NumericCast<int64_t>(lo_rank), sample.end(), comp);
+		const auto lo = sample[lo_rank];
+		std::nth_element(sample.begin() + NumericCast<int64_t>(lo_rank), sample.begin() + NumericCast<int64_t>(hi_rank),
+		                 sample.end(), comp);
+		const auto hi = sample[hi_rank];
+
+		//	Three way partition: [< lo][lo, hi][> hi]
+		auto lt = begin;
+		auto gt = end;
+		for (auto i = begin; i < gt;) {
+			if (has_lo && comp(v_t[i], lo)) {
+				std::swap(v_t[lt++], v_t[i++]);
+			} else if (has_hi && comp(hi, v_t[i])) {
+				std::swap(v_t[i], v_t[--gt]);
+			} else {
+				++i;
+			}
+		}
+
+		//	If we missed, the partitioning is still valid for a full search
+		if (lt <= interp.FRN && interp.CRN < gt) {
+			interp.begin = lt;
+			interp.end = gt;
+		}
+	}
+};
+
 struct QuantileIncluded {
 	inline explicit QuantileIncluded(const ValidityMask &fmask_p, const ValidityMask &dmask_p)
 	    : fmask(fmask_p), dmask(dmask_p) {
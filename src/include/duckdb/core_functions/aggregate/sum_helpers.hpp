@@ -63,6 +63,11 @@ struct RegularAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		state.value += input * int64_t(count);
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
 };
 
 struct HugeintAdd {
@@ -75,6 +80,11 @@ struct HugeintAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		AddNumber(state, Hugeint::Multiply(input, UnsafeNumericCast<int64_t>(count)));
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value = Hugeint::Subtract(state.value, input);
+	}
 };
 
 struct KahanAdd {
@@ -140,6 +150,11 @@ struct AddToHugeint {
 			}
 		}
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
 };
 
 template <class STATEOP, class ADDOP>
@@ -166,6 +181,12 @@ struct BaseSumOperation {
 		STATEOP::template AddValues<STATE>(state, count);
 		ADDOP::template AddConstant<STATE, INPUT_TYPE>(state, input, count);
 	}
+	//! Undo an Operation (only exact for the integer adders)
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Remove(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		ADDOP::template SubtractNumber<STATE, INPUT_TYPE>(state, input);
+	}
 
 	static bool IgnoreNull() {
 		return true;
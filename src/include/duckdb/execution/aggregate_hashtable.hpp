@@ -57,6 +57,8 @@ public:
 	idx_t Capacity() const;
 	//! Threshold at which to resize the HT
 	idx_t ResizeThreshold() const;
+	//! Number of tuples that were added to the HT
+	idx_t GetSinkCount() const;
 
 	//! Add the given data to the HT, computing the aggregates grouped by the
 	//! data in the group chunk. When resize = true, aggregates will not be
@@ -85,6 +87,12 @@ public:
 	void ClearPointerTable();
 	//! Resets the group count to 0
 	void ResetCount();
+	//! Resets the number of tuples that were added to the HT to 0
+	void ResetSinkCount();
+	//! Stop looking up groups: every added tuple is appended as a new group, duplicates must be combined later
+	void SkipLookups();
+	//! Whether lookups are skipped
+	bool SkipsLookups() const;
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -116,6 +124,9 @@ private:
 		Vector addresses;
 		unsafe_unique_array<UnifiedVectorFormat> group_data;
 		DataChunk group_chunk;
+		//! Slices of the addresses and payload used when updating the aggregates tile by tile
+		Vector tile_addresses;
+		DataChunk tile_payload;
 	} state;
 
 	//! The number of radix bits to partition by
@@ -128,6 +139,10 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! The number of tuples that were added to the HT
+	idx_t sink_count;
+	//! Whether to skip lookups (see SkipLookups)
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -156,6 +171,11 @@ private:
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
 
+	//! The number of rows to update the aggregates for at a time, or 0 if the whole chunk should be updated at once
+	idx_t GetUpdateTileSize(DataChunk &payload, const unsafe_vector<idx_t> &filter) const;
+	//! Updates the states of the aggregates in the filter with the rows of the payload
+	void UpdateAggregates(DataChunk &payload, Vector &addresses, const unsafe_vector<idx_t> &filter);
+
 	//! Verify the pointer table of the HT
 	void Verify();
 };
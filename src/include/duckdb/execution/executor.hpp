@@ -13,6 +13,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/vector_size.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 
@@ -21,13 +22,16 @@
 namespace duckdb {
 class ClientContext;
 class DataChunk;
+class MetaPipeline;
 class PhysicalOperator;
 class PipelineExecutor;
+class QueryAdmissionState;
 class OperatorState;
 class QueryProfiler;
 class ThreadContext;
 class Task;
 
+struct InterruptDoneSignalState;
 struct PipelineEventStack;
 struct ProducerToken;
 struct ScheduleEventData;
@@ -43,6 +47,9 @@ public:
 
 	ClientContext &context;
 
+	//! Plans that consist of a single pipeline whose source emits at most this many rows are executed inline
+	static constexpr const idx_t INLINE_EXECUTION_THRESHOLD = STANDARD_VECTOR_SIZE;
+
 public:
 	static Executor &Get(ClientContext &context);
 
@@ -65,6 +72,8 @@ public:
 
 	//! True if an error has been thrown
 	bool HasError();
+	//! Whether all errors that were pushed using PushError are of the given type
+	bool HasOnlyErrorsOfType(ExceptionType type);
 	//! Throw the exception that was pushed using PushError.
 	//! Should only be called if HasError returns true
 	void ThrowException();
@@ -104,6 +113,10 @@ public:
 
 	//! Returns true if all pipelines have been completed
 	bool ExecutionIsFinished();
+	//! Whether or not the current plan is executed on the calling thread, without scheduling any events
+	bool IsExecutingInline() const {
+		return inline_pipeline != nullptr;
+	}
 
 	void RegisterTask() {
 		executor_tasks++;
@@ -116,8 +129,15 @@ private:
 	//! Check if the streaming query result is waiting to be fetched from, must hold the 'executor_lock'
 	bool ResultCollectorIsBlocked();
 	void InitializeInternal(PhysicalOperator &physical_plan);
+	//! Waits until the estimated memory of the plan can be admitted by the TemporaryMemoryManager
+	void AdmitQuery(PhysicalOperator &physical_plan);
 
 	void ScheduleEvents(const vector<shared_ptr<MetaPipeline>> &meta_pipelines);
+
+	//! Whether or not the plan is small enough to be executed on the calling thread, without scheduling any events
+	bool CanExecuteInline(const vector<shared_ptr<MetaPipeline>> &meta_pipelines);
+	//! Executes (part of) the inline pipeline on the calling thread, errors are pushed to the error manager
+	void ExecuteInline();
 	void ScheduleEventsInternal(ScheduleEventData &event_data);
 
 	static void VerifyScheduledEvents(const ScheduleEventData &event_data);
@@ -148,8 +168,16 @@ private:
 	unique_ptr<PipelineExecutor> root_executor;
 	//! The current root pipeline index
 	idx_t root_pipeline_idx;
+	//! The pipeline that is executed inline (if any)
+	shared_ptr<Pipeline> inline_pipeline;
+	//! The pipeline executor for the inline pipeline
+	unique_ptr<PipelineExecutor> inline_executor;
+	//! Signalled when an operator of the inline pipeline is no longer blocked
+	shared_ptr<InterruptDoneSignalState> inline_signal;
 	//! The producer of this query
 	unique_ptr<ProducerToken> producer;
+	//! The memory admission of this query, released when execution finishes
+	unique_ptr<QueryAdmissionState> admission;
 	//! List of events
 	vector<shared_ptr<Event>> events;
 	//! The query profiler
@@ -10,12 +10,14 @@
 
 #include "duckdb/common/array.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/vector_operations/aggregate_executor.hpp"
 #include <iomanip>
+#include <thread>
 
 namespace duckdb {
 
@@ -104,6 +106,13 @@ struct MergeSortTree {
 	}
 	explicit MergeSortTree(Elements &&lowest_level, const CMP &cmp = CMP());
 
+	//! Set up the (empty) upper levels of the tree on top of the lowest level. Not thread-safe.
+	void Allocate(Elements &&lowest_level);
+	//! Build the upper levels of an allocated tree.
+	//! Multiple threads can call this at the same time: the runs of each level are merged in parallel.
+	//! Returns when the whole tree has been built.
+	void Build();
+
 	idx_t SelectNth(const SubFrames &frames, idx_t n) const;
 
 	inline ElementType NthElement(idx_t i) const {
@@ -120,6 +129,34 @@ struct MergeSortTree {
 	static constexpr auto CASCADING = C;
 
 protected:
+	//! The length of the runs in the given level
+	static idx_t RunLength(idx_t level_idx) {
+		idx_t run_length = 1;
+		for (idx_t i = 0; i < level_idx; ++i) {
+			run_length *= FANOUT;
+		}
+		return run_length;
+	}
+	//! The number of runs in the given level
+	idx_t RunCount(idx_t level_idx) const {
+		const auto run_length = RunLength(level_idx);
+		return (tree[0].first.size() + run_length - 1) / run_length;
+	}
+	//! Claim the next run to merge, waiting for the previous level to complete if necessary.
+	//! Returns false when the tree is complete.
+	bool TryNextRun(idx_t &level_idx, idx_t &run_idx);
+	//! Merge the child runs of a single run
+	void BuildRun(idx_t level_idx, idx_t run_idx);
+
+	//! Lock for the parallel build state
+	mutex build_lock;
+	//! The level being built
+	idx_t build_level = 0;
+	//! The next run to build in the current level
+	idx_t build_run = 0;
+	//! The number of completed runs in the current level
+	idx_t build_complete = 0;
+
 	RunElement StartGames(Games &losers, const RunElements &elements, const RunElement &sentinel) {
 		const auto elem_nodes = elements.size();
 		const auto game_nodes = losers.size();
@@ -251,91 +288,155 @@ protected:
 
 template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
 MergeSortTree<E, O, CMP, F, C>::MergeSortTree(Elements &&lowest_level, const CMP &cmp) : cmp(cmp) {
+	Allocate(std::move(lowest_level));
+	Build();
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Allocate(Elements &&lowest_level) {
 	const auto fanout = F;
 	const auto cascading = C;
 	const auto count = lowest_level.size();
+	tree.clear();
 	tree.emplace_back(Level(std::move(lowest_level), Offsets()));
 
-	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
-
-	//	Fan in parent levels until we are at the top
+	//	Allocate the parent levels until we are at the top
 	//	Note that we don't build the top layer as that would just be all the data.
 	for (idx_t child_run_length = 1; child_run_length < count;) {
 		const auto run_length = child_run_length * fanout;
 		const auto num_runs = (count + run_length - 1) / run_length;
 
-		Elements elements;
-		elements.reserve(count);
+		Elements elements(count);
 
-		//	Allocate cascading pointers only if there is room
+		//	Allocate cascading pointers only if there is room.
+		//	Each run has FANOUT pointers for every CASCADING elements, plus two terminal sets,
+		//	so every run (except the last one) has the same number of pointers.
 		Offsets cascades;
 		if (cascading > 0 && run_length > cascading) {
-			const auto num_cascades = fanout * num_runs * (run_length / cascading + 2);
-			cascades.reserve(num_cascades);
+			const auto last_run = count - (num_runs - 1) * run_length;
+			const auto num_cascades =
+			    fanout * ((num_runs - 1) * (run_length / cascading + 2) + (last_run + cascading - 1) / cascading + 2);
+			cascades.resize(num_cascades);
 		}
 
-		//	Create each parent run by merging the child runs using a tournament tree
-		// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
-		//	TODO: Because the runs are independent, they can be parallelised with parallel_for
-		const auto &child_level = tree.back();
-		for (idx_t run_idx = 0; run_idx < num_runs; ++run_idx) {
-			//	Position markers for scanning the children.
-			using Bounds = pair<idx_t, idx_t>;
-			array<Bounds, fanout> bounds;
-			//	Start with first element of each (sorted) child run
-			RunElements players;
-			const auto child_base = run_idx * run_length;
-			for (idx_t child_run = 0; child_run < fanout; ++child_run) {
-				const auto child_idx = child_base + child_run * child_run_length;
-				bounds[child_run] = {MinValue<idx_t>(child_idx, count),
-				                     MinValue<idx_t>(child_idx + child_run_length, count)};
-				if (bounds[child_run].first != bounds[child_run].second) {
-					players[child_run] = {child_level.first[child_idx], child_run};
-				} else {
-					//	Empty child
-					players[child_run] = SENTINEL;
-				}
-			}
+		tree.emplace_back(std::move(elements), std::move(cascades));
+		child_run_length = run_length;
+	}
 
-			//	Play the first round and extract the winner
-			Games games;
-			auto winner = StartGames(games, players, SENTINEL);
-			while (winner != SENTINEL) {
-				// Add fractional cascading pointers
-				// if we are on a fraction boundary
-				if (cascading > 0 && run_length > cascading && elements.size() % cascading == 0) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+	//	Start building from the first parent level
+	build_level = 1;
+	build_run = 0;
+	build_complete = 0;
+}
 
-				//	Insert new winner element into the current run
-				elements.emplace_back(winner.first);
-				const auto child_run = winner.second;
-				auto &child_idx = bounds[child_run].first;
-				++child_idx;
-
-				//	Move to the next entry in the child run (if any)
-				if (child_idx < bounds[child_run].second) {
-					winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
-				} else {
-					winner = ReplayGames(games, child_run, SENTINEL);
-				}
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::Build() {
+	idx_t level_idx;
+	idx_t run_idx;
+	while (TryNextRun(level_idx, run_idx)) {
+		BuildRun(level_idx, run_idx);
+
+		//	If that was the last run, move up to the next level
+		lock_guard<mutex> build_guard(build_lock);
+		if (++build_complete == RunCount(level_idx)) {
+			++build_level;
+			build_run = 0;
+			build_complete = 0;
+		}
+	}
+}
+
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+bool MergeSortTree<E, O, CMP, F, C>::TryNextRun(idx_t &level_idx, idx_t &run_idx) {
+	while (true) {
+		{
+			lock_guard<mutex> build_guard(build_lock);
+			if (build_level >= tree.size()) {
+				return false;
+			}
+			if (build_run < RunCount(build_level)) {
+				level_idx = build_level;
+				run_idx = build_run++;
+				return true;
 			}
+		}
+		//	Nothing left at this level, so wait until the other threads are done with it.
+		std::this_thread::yield();
+	}
+}
 
-			// Add terminal cascade pointers to the end
-			if (cascading > 0 && run_length > cascading) {
-				for (idx_t j = 0; j < 2; ++j) {
-					for (idx_t i = 0; i < fanout; ++i) {
-						cascades.emplace_back(bounds[i].first);
-					}
-				}
+template <typename E, typename O, typename CMP, uint64_t F, uint64_t C>
+void MergeSortTree<E, O, CMP, F, C>::BuildRun(idx_t level_idx, idx_t run_idx) {
+	const auto fanout = F;
+	const auto cascading = C;
+	const auto count = tree[0].first.size();
+	const auto child_run_length = RunLength(level_idx - 1);
+	const auto run_length = child_run_length * fanout;
+
+	const RunElement SENTINEL(MergeSortTraits<ElementType>::SENTINEL(), MergeSortTraits<idx_t>::SENTINEL());
+
+	//	Create the parent run by merging the child runs using a tournament tree
+	// 	https://en.wikipedia.org/wiki/K-way_merge_algorithm
+	//	The runs are independent, so they can be written in place.
+	const auto &child_level = tree[level_idx - 1];
+	auto &elements = tree[level_idx].first;
+	auto &cascades = tree[level_idx].second;
+	const auto has_cascades = cascading > 0 && run_length > cascading;
+
+	//	Position markers for scanning the children.
+	using Bounds = pair<idx_t, idx_t>;
+	array<Bounds, fanout> bounds;
+	//	Start with first element of each (sorted) child run
+	RunElements players;
+	const auto child_base = run_idx * run_length;
+	for (idx_t child_run = 0; child_run < fanout; ++child_run) {
+		const auto child_idx = child_base + child_run * child_run_length;
+		bounds[child_run] = {MinValue<idx_t>(child_idx, count), MinValue<idx_t>(child_idx + child_run_length, count)};
+		if (bounds[child_run].first != bounds[child_run].second) {
+			players[child_run] = {child_level.first[child_idx], child_run};
+		} else {
+			//	Empty child
+			players[child_run] = SENTINEL;
+		}
+	}
+
+	//	The output positions of this run
+	auto element_idx = child_base;
+	auto cascade_idx = run_idx * fanout * (run_length / cascading + 2);
+
+	//	Play the first round and extract the winner
+	Games games;
+	auto winner = StartGames(games, players, SENTINEL);
+	while (winner != SENTINEL) {
+		// Add fractional cascading pointers
+		// if we are on a fraction boundary
+		if (has_cascades && element_idx % cascading == 0) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				cascades[cascade_idx++] = bounds[i].first;
 			}
 		}
 
-		//	Insert completed level and move up to the next one
-		tree.emplace_back(std::move(elements), std::move(cascades));
-		child_run_length = run_length;
+		//	Insert new winner element into the current run
+		elements[element_idx++] = winner.first;
+		const auto child_run = winner.second;
+		auto &child_idx = bounds[child_run].first;
+		++child_idx;
+
+		//	Move to the next entry in the child run (if any)
+		if (child_idx < bounds[child_run].second) {
+			winner = ReplayGames(games, child_run, {child_level.first[child_idx], child_run});
+		} else {
+			winner = ReplayGames(games, child_run, SENTINEL);
+		}
+	}
+
+	// Add terminal cascade pointers to the end
+	if (has_cascades) {
+		for (idx_t j = 0; j < 2; ++j) {
+			for (idx_t i = 0; i < fanout; ++i) {
+				cascades[cascade_idx++] = bounds[i].first;
+			}
+		}
 	}
 }
 
@@ -49,14 +49,39 @@ public:
 	                      const vector<unique_ptr<Expression>> *group_expressions);
 	//! The data used by the hashtables
 	vector<unique_ptr<GroupedAggregateData>> grouped_aggregate_data;
-	//! The hashtables
+	//! The hashtables (a single one if the tables are shared, see below)
 	vector<unique_ptr<RadixPartitionedHashTable>> radix_tables;
 	//! The groups (arguments)
 	vector<GroupingSet> grouping_sets;
+	//! For every table, the index of the first aggregate that uses it
+	vector<idx_t> table_aggregates;
 	const DistinctAggregateCollectionInfo &info;
 
+	//! If there are several tables whose arguments have the same types, the distinct values of all tables are
+	//! deduplicated in one shared hash table on (groups, table index, arguments). The arguments of tables share the
+	//! columns of the shared table, so this needs less memory, and the shared table spills as a whole.
+	unique_ptr<GroupedAggregateData> shared_data;
+	//! The grouping set of the shared table
+	GroupingSet shared_grouping_set;
+	//! The input columns of the groups
+	vector<idx_t> shared_groups;
+	//! The types of the argument columns of the shared table
+	vector<LogicalType> shared_argument_types;
+	//! For every table, the argument columns of the shared table its arguments are stored in
+	vector<vector<idx_t>> shared_columns;
+
 public:
 	bool IsDistinct(idx_t index) const;
+	//! Whether the distinct values of all tables are stored in a single shared hash table
+	bool IsShared() const;
+	//! Reference the input of a table in the layout of the shared table
+	void PopulateSharedChunk(idx_t table_idx, DataChunk &input, DataChunk &shared_chunk) const;
+	//! Reference the rows of a table in the output of the shared table, in the layout of the output of the table
+	void SliceSharedOutput(idx_t table_idx, DataChunk &shared_output, DataChunk &table_output,
+	                       SelectionVector &sel) const;
+
+private:
+	void InitializeShared(const GroupingSet &groups, const vector<unique_ptr<Expression>> *group_expressions);
 };
 
 struct DistinctAggregateState {
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by and aggregation over input in which the rows of a group are adjacent
+//! (e.g., because the input is sorted on the groups). Only the aggregate states of the current group are kept, and
+//! a group is emitted as soon as the next one starts. The input must arrive in order, so this operator is not parallel.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(ClientContext &context, vector<LogicalType> types,
+	                           vector<unique_ptr<Expression>> aggregates, vector<unique_ptr<Expression>> groups,
+	                           idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const final;
+
+	bool RequiresFinalExecute() const final {
+		return true;
+	}
+
+	bool ParallelOperator() const override {
+		return false;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+	//! Whether the rows of each group are adjacent in the output of the given plan
+	static bool CanStreamGroups(const PhysicalOperator &plan, const vector<unique_ptr<Expression>> &groups);
+	//! Whether the output of the given plan is sorted on the given orders (ties may be in any order)
+	static bool IsSortedOn(const PhysicalOperator &plan, const vector<BoundOrderByNode> &orders);
+
+public:
+	//! The group types
+	vector<LogicalType> group_types;
+	//! The payload types
+	vector<LogicalType> payload_types;
+	//! The aggregates to be computed
+	vector<AggregateObject> aggregate_objects;
+
+	unordered_map<Expression *, size_t> filter_indexes;
+};
+
+} // namespace duckdb
@@ -13,12 +13,15 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause, or an ORDER BY
+//! that the input is already sorted on)
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
-	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+	//! Whether the window function can be computed in a single pass over the output of the child
+	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr,
+	                                const PhysicalOperator &child);
 
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
@@ -38,6 +38,8 @@ public:
 
 	static void SetExtensionVariable(ClientContext &context, ExtensionOption &extension_option, const string &name,
 	                                 SetScope scope, const Value &value);
+	//! Drops the cached plans and results that may depend on a setting or variable that is changed
+	static void InvalidateCaches(ClientContext &context, SetScope scope);
 
 public:
 	const string name;
@@ -52,6 +52,10 @@ public:
 	bool ParallelSink() const override {
 		return IsSink();
 	}
+
+private:
+	//! Builds the histograms and column dependencies of the table from the sampled rows
+	void BuildHistograms(GlobalSinkState &state) const;
 };
 
 } // namespace duckdb
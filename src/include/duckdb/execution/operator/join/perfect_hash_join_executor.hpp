@@ -19,14 +19,22 @@ class HashJoinOperatorState;
 class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
-struct PerfectHashJoinStats {
+struct PerfectHashJoinKeyStats {
 	Value build_min;
 	Value build_max;
 	Value probe_min;
 	Value probe_max;
+	//! The range of this key on the build side (i.e., max - min)
+	idx_t build_range = 0;
+};
+
+struct PerfectHashJoinStats {
+	//! Statistics of each of the join keys
+	vector<PerfectHashJoinKeyStats> keys;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The range of the combined key domain (i.e., the product of the per-key domains minus one)
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -44,21 +52,19 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable(const vector<LogicalType> &key_types);
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Computes the position in the perfect hash table of the rows in "sel" and writes them to "slots"
+	//! Rows with a NULL key or a key outside of the build domain are removed from "sel"
+	idx_t ComputeSlots(vector<Vector> &keys, idx_t count, SelectionVector &sel, idx_t sel_count, idx_t slots[]);
+	idx_t ComputeSlotsSwitch(Vector &source, idx_t key_idx, idx_t count, SelectionVector &sel, idx_t sel_count,
+	                         idx_t slots[]);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	idx_t TemplatedComputeSlots(Vector &source, idx_t key_idx, idx_t count, SelectionVector &sel, idx_t sel_count,
+	                            idx_t slots[]);
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	bool FullScanHashTable(const vector<LogicalType> &key_types);
 
 private:
 	const PhysicalHashJoin &join;
@@ -67,6 +73,8 @@ private:
 	PerfectHashTable perfect_hash_table;
 	//! Build and probe statistics
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The multiplier of each key when computing the position in the perfect hash table
+	vector<idx_t> key_strides;
 	//! Stores the occurences of each value in the build side
 	unsafe_unique_array<bool> bitmap_build_idx;
 	//! Stores the number of unique keys in the build side
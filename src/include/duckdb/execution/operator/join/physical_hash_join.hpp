@@ -52,6 +52,9 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The table indexes of the leaves of the build side, which identify it when its cardinality is fed back into the
+	//! optimizer (see CardinalityFeedback)
+	vector<idx_t> build_table_indexes;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
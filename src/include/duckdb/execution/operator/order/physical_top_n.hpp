@@ -12,6 +12,9 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+class TopNGlobalState;
+class TopNHeap;
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +29,8 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filter on the first order column that is pushed into the scan (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -55,6 +60,10 @@ public:
 	}
 
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+private:
+	//! Publish the boundary value of a reduced heap to the dynamic filter, if it is tighter than the current one
+	void UpdateDynamicFilter(TopNGlobalState &gstate, TopNHeap &heap) const;
 };
 
 } // namespace duckdb
@@ -95,6 +95,9 @@ protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalPivot &op);
 
 	unique_ptr<PhysicalOperator> PlanAsOfJoin(LogicalComparisonJoin &op);
+	//! Plans a join with a narrow band condition as a hash join on buckets (or returns nullptr if not possible)
+	unique_ptr<PhysicalOperator> PlanBandJoin(LogicalComparisonJoin &op, unique_ptr<PhysicalOperator> &left,
+	                                          unique_ptr<PhysicalOperator> &right);
 	unique_ptr<PhysicalOperator> PlanComparisonJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanDelimJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> ExtractAggregateExpressions(unique_ptr<PhysicalOperator> child,
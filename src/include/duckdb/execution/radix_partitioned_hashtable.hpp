@@ -41,6 +41,8 @@ public:
 	          const unsafe_vector<idx_t> &filter) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
+	//! Whether the Sink stopped pre-aggregating in the thread-local HTs
+	static bool SkippedLookups(GlobalSinkState &sink);
 
 public:
 	//! Source interface
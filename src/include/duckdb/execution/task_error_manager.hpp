@@ -37,6 +37,17 @@ public:
 		return !exceptions.empty();
 	}
 
+	//! Whether all errors that occurred are of the given type
+	bool HasOnlyErrorsOfType(ExceptionType type) {
+		lock_guard<mutex> elock(error_lock);
+		for (auto &error : exceptions) {
+			if (error.Type() != type) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	void ThrowException() {
 		lock_guard<mutex> elock(error_lock);
 		D_ASSERT(!exceptions.empty());
@@ -116,6 +116,22 @@ public:
 	              Vector &result, idx_t count, idx_t row_idx) const override;
 };
 
+//! Computes invertible aggregates by adding and removing rows from a running state as the frame slides
+class WindowRemovableAggregator : public WindowAggregator {
+public:
+	WindowRemovableAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                          const LogicalType &result_type_p, const WindowExcludeMode exclude_mode);
+	~WindowRemovableAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetGlobalState(idx_t group_count,
+	                                                 const ValidityMask &partition_mask) const override;
+	void Finalize(WindowAggregatorState &gstate, WindowAggregatorState &lstate, const FrameStats &stats) override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -94,6 +94,27 @@ struct AggregateFunctionInfo {
 	}
 };
 
+//! Adapts the Remove method of an aggregate operation to the executor interface of Operation
+template <class OP>
+struct AggregateRemoveOperation {
+	template <class INPUT_TYPE, class STATE, class>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	static bool IgnoreNull() {
+		return OP::IgnoreNull();
+	}
+};
+
 class AggregateFunction : public BaseScalarFunction { // NOLINT: work-around bug in clang-tidy
 public:
 	AggregateFunction(const string &name, const vector<LogicalType> &arguments, const LogicalType &return_type,
@@ -164,6 +185,9 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The inverse of the update function, which removes the inputs from the states (may be null).
+	//! Only set for aggregates where this is exact, so sliding windows can add and remove rows from a running state.
+	aggregate_update_t remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -258,6 +282,14 @@ public:
 		AggregateExecutor::UnaryScatter<STATE, T, OP>(inputs[0], states, aggr_input_data, count);
 	}
 
+	template <class STATE, class INPUT_TYPE, class OP>
+	static void UnaryScatterRemove(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+	                               Vector &states, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryScatter<STATE, INPUT_TYPE, AggregateRemoveOperation<OP>>(inputs[0], states,
+		                                                                                aggr_input_data, count);
+	}
+
 	template <class STATE, class INPUT_TYPE, class OP>
 	static void UnaryUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
 	                        idx_t count) {
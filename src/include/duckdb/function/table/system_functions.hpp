@@ -41,6 +41,18 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBQueryAdmissionsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBPlanCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBResultCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -105,6 +117,10 @@ struct DuckDBTablesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBTaskQueuesFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTemporaryFilesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
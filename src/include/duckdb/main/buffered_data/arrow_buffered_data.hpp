@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/arrow_buffered_data.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/main/buffered_data/buffered_data.hpp"
+#include "duckdb/parallel/interrupt.hpp"
+
+namespace duckdb {
+
+class StreamQueryResult;
+
+//! A record batch that was produced by the result collector, together with the size of the data it holds
+struct BufferedArrowArray {
+	unique_ptr<ArrowArrayWrapper> array;
+	idx_t allocation_size;
+};
+
+//! ArrowBufferedData holds the Arrow record batches that are produced by the pipeline threads of a streaming query.
+//! Record batches are kept in the order of their batch index, and the sinks are blocked when the buffer is full.
+class ArrowBufferedData : public BufferedData {
+public:
+	static constexpr const BufferedData::Type TYPE = BufferedData::Type::ARROW;
+
+public:
+	explicit ArrowBufferedData(weak_ptr<ClientContext> context);
+
+public:
+	void Append(unique_ptr<ArrowArrayWrapper> array, idx_t allocation_size, idx_t batch);
+	void BlockSink(const InterruptState &blocked_sink, idx_t batch);
+
+	bool ShouldBlockBatch(idx_t batch);
+	StreamExecutionResult ExecuteTaskInternal(StreamQueryResult &result, ClientContextLock &context_lock) override;
+	//! Arrow results can only be fetched as record batches, see ScanArrow
+	unique_ptr<DataChunk> Scan() override;
+	//! Returns the next record batch, or nullptr if all record batches have been scanned
+	unique_ptr<ArrowArrayWrapper> ScanArrow();
+	void UpdateMinBatchIndex(idx_t min_batch_index);
+	bool BufferIsEmpty();
+	void UnblockSinks() override;
+
+	inline idx_t ReadQueueCapacity() const {
+		return read_queue_capacity;
+	}
+	inline idx_t BufferCapacity() const {
+		return buffer_capacity;
+	}
+
+private:
+	void MoveCompletedBatches(lock_guard<mutex> &lock);
+
+private:
+	//! The record batches of batches that cannot be read yet, because a lower batch is still in progress
+	map<idx_t, deque<BufferedArrowArray>> buffer;
+	idx_t buffer_capacity;
+	atomic<idx_t> buffer_byte_count;
+
+	//! The record batches that can be read, in order
+	deque<BufferedArrowArray> read_queue;
+	idx_t read_queue_capacity;
+	atomic<idx_t> read_queue_byte_count;
+
+	map<idx_t, InterruptState> blocked_sinks;
+
+	idx_t min_batch;
+};
+
+} // namespace duckdb
@@ -25,7 +25,7 @@ class ClientContextLock;
 
 class BufferedData {
 protected:
-	enum class Type { SIMPLE, BATCHED };
+	enum class Type { SIMPLE, BATCHED, ARROW };
 
 public:
 	BufferedData(Type type, weak_ptr<ClientContext> context_p);
@@ -39,6 +39,9 @@ public:
 	shared_ptr<ClientContext> GetContext() {
 		return context.lock();
 	}
+	Type GetType() const {
+		return type;
+	}
 	bool Closed() const {
 		if (context.expired()) {
 			return true;
@@ -93,6 +93,13 @@ struct ClientConfig {
 	idx_t perfect_ht_threshold = 12;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
+	//! Re-plan a query when the observed cardinality of a hash join build side differs from its estimate by more than
+	//! this factor (0 = disabled)
+	double reoptimization_threshold = 0;
+	//! The share of the scheduler threads the queries of this client get relative to other running queries
+	idx_t query_priority = 1;
+	//! The maximum number of scheduler threads that concurrently execute tasks of a query (0 = no limit)
+	idx_t max_query_threads = 0;
 	//! The number of rows to accumulate before flushing during a partitioned write
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 	//! The amount of rows we can keep open before we close and flush them during a partitioned write
@@ -132,6 +139,9 @@ struct ClientConfig {
 	//! Function that is used to create the result collector for a materialized result
 	//! Defaults to PhysicalMaterializedCollector
 	get_result_collector_t result_collector = nullptr;
+	//! Function that is used to create the result collector for a streaming result
+	//! Defaults to PhysicalBufferedCollector (or PhysicalBufferedBatchCollector)
+	get_result_collector_t streaming_result_collector = nullptr;
 
 	//! If HTTP logging is enabled or not.
 	bool enable_http_logging = false;
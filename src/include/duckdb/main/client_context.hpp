@@ -46,6 +46,7 @@ class ClientContextLock;
 struct CreateScalarFunctionInfo;
 class ScalarFunctionCatalogEntry;
 struct ActiveQueryContext;
+class CardinalityFeedback;
 struct ParserOptions;
 class SimpleBufferedData;
 class BufferedData;
@@ -67,6 +68,7 @@ class ClientContext : public enable_shared_from_this<ClientContext> {
 	friend class BufferedData;        // ExecuteTaskInternal
 	friend class SimpleBufferedData;  // ExecuteTaskInternal
 	friend class BatchedBufferedData; // ExecuteTaskInternal
+	friend class ArrowBufferedData;   // ExecuteTaskInternal
 	friend class StreamQueryResult;   // LockContext
 	friend class ConnectionManager;
 
@@ -185,6 +187,8 @@ public:
 
 	//! Returns the current query string (if any)
 	const string &GetCurrentQuery();
+	//! Returns the cardinalities observed while executing the current query, if the query can be re-optimized
+	optional_ptr<CardinalityFeedback> GetCardinalityFeedback();
 
 	//! Fetch a list of table names that are required for a given query
 	DUCKDB_API unordered_set<string> GetTableNames(const string &query);
@@ -236,6 +240,11 @@ private:
 	unique_ptr<PendingQueryResult> PendingStatementInternal(ClientContextLock &lock, const string &query,
 	                                                        unique_ptr<SQLStatement> statement,
 	                                                        const PendingQueryParameters &parameters);
+	//! Executes a SELECT statement through the plan cache, if it is enabled and the statement can be parameterized.
+	//! Returns nullptr if the statement has to be planned as-is.
+	unique_ptr<PendingQueryResult> PendingCachedStatement(ClientContextLock &lock, const string &query,
+	                                                      const SQLStatement &statement,
+	                                                      const PendingQueryParameters &parameters);
 	unique_ptr<QueryResult> RunStatementInternal(ClientContextLock &lock, const string &query,
 	                                             unique_ptr<SQLStatement> statement, bool allow_stream_result,
 	                                             bool verify = true);
@@ -253,6 +262,9 @@ private:
 	//! Wait until a task is available to execute
 	void WaitForTask(ClientContextLock &lock, BaseQueryResult &result);
 	PendingExecutionResult ExecuteTaskInternal(ClientContextLock &lock, BaseQueryResult &result, bool dry_run = false);
+	//! Plans the current query again using the observed cardinalities, after its execution was aborted to re-optimize
+	//! it. Returns false if the query was not aborted for re-optimization, or if re-planning fails (setting "error")
+	bool ReoptimizeQuery(ClientContextLock &lock, ErrorData &error);
 
 	unique_ptr<PendingQueryResult> PendingStatementOrPreparedStatementInternal(
 	    ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
@@ -282,6 +294,8 @@ private:
 	unique_ptr<ActiveQueryContext> active_query;
 	//! The current query progress
 	QueryProgress query_progress;
+	//! Whether or not the current query was interrupted through Interrupt (rather than by an error in the executor)
+	atomic<bool> interrupted_by_client;
 };
 
 class ClientContextLock {
@@ -203,6 +203,8 @@ struct DBConfigOptions {
 	bool arrow_use_list_view = false;
 	//! Whether when producing arrow objects we produce string_views or regular strings
 	bool produce_arrow_string_views = false;
+	//! Whether Arrow result streams (ADBC) are produced by the pipeline threads while the query runs
+	bool arrow_streaming_results = false;
 	//! Database configuration variables as controlled by SET
 	case_insensitive_map_t<Value> set_variables;
 	//! Database configuration variable default values;
@@ -237,6 +239,17 @@ struct DBConfigOptions {
 	idx_t allocator_flush_threshold = 134217728;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether rescheduled and follow-up tasks are queued on the thread that last executed them or scheduled them,
+	//! where idle threads can steal them
+	bool scheduler_work_stealing = true;
+	//! Whether queries wait for admission until their estimated memory fits next to that of the running queries
+	bool enable_query_admission = false;
+	//! How long a query waits for admission before it runs anyway (in milliseconds)
+	idx_t query_admission_timeout = 2000;
+	//! The maximum number of cached plans of repeated queries (0 disables the plan cache)
+	idx_t plan_cache_size = 0;
+	//! The maximum memory of cached query results (0 disables the result cache)
+	idx_t result_cache_size = 0;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -25,6 +25,8 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class PlanCache;
+class ResultCache;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
@@ -54,6 +56,8 @@ public:
 	DUCKDB_API FileSystem &GetFileSystem();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API PlanCache &GetPlanCache();
+	DUCKDB_API ResultCache &GetResultCache();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const string &extension_name, ExtensionInstallInfo &install_info);
@@ -85,6 +89,8 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<PlanCache> plan_cache;
+	unique_ptr<ResultCache> result_cache;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_map<string, ExtensionInfo> loaded_extensions_info;
 	ValidChecker db_validity;
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/materialized_view.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class ClientContext;
+struct DataTableInfo;
+
+//! A base table read by a materialized view, and how much of it has been applied to the view
+struct MaterializedViewSource {
+	weak_ptr<DataTableInfo> table;
+	//! The rows with a row id below this have been applied to the view
+	idx_t row_count = 0;
+	//! The row change count of the table (see DataTableInfo::GetRowChangeCount) when the view was refreshed
+	idx_t row_change_count = 0;
+};
+
+//! The maintenance state of a materialized view. The state only lives in memory: a view without a (valid) state is
+//! recomputed on its next refresh, after which it is maintained incrementally again
+class MaterializedViewState : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "materialized_view_state";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+public:
+	mutex lock;
+	//! The storage of the view
+	weak_ptr<DataTableInfo> view;
+	//! The commit id of the last change to the view, used to detect changes that were not made by a refresh
+	transaction_t view_commit_id = 0;
+	//! Whether or not the sources describe the current contents of the view
+	bool valid = false;
+	//! The base tables of the view, one per table reference in the query
+	vector<MaterializedViewSource> sources;
+	//! The id of the last refresh that was started
+	idx_t refresh_id = 0;
+	//! Whether or not the last refresh that was started has not finished yet
+	bool refresh_pending = false;
+	//! The sources of the view once the pending refresh has committed
+	vector<MaterializedViewSource> pending_sources;
+};
+
+//! Materialized views are tables that store the result of a query, tagged with that query. Refreshing a view whose
+//! base tables only received inserts since the last refresh applies the inserted rows only, provided the view is a
+//! select-project-join query, optionally grouped and aggregated with SUM, COUNT, MIN and MAX. Other views, and views
+//! whose base tables had rows deleted or updated, are recomputed.
+class MaterializedView {
+public:
+	//! The tag that stores the query of a materialized view
+	static constexpr const char *QUERY_TAG = "materialized_view";
+
+	//! Returns the statements that create and populate the materialized view "name"
+	static string CreateQuery(ClientContext &context, const string &name, const string &query);
+	//! Returns the statements that bring the materialized view "name" up to date with its base tables
+	static string RefreshQuery(ClientContext &context, const string &name);
+
+	//! Creates the table of a materialized view
+	static void CreateTable(ClientContext &context, const string &catalog, const string &schema, const string &name,
+	                        const string &query);
+	//! Runs the statements of the refresh "refresh_id" of a materialized view in a transaction of their own
+	static void Refresh(ClientContext &context, const string &catalog, const string &schema, const string &name,
+	                    idx_t refresh_id, const string &statements);
+};
+
+} // namespace duckdb
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class PreparedStatementData;
+class SQLStatement;
+
+//! A cached plan of a query, in which the constants that are compared with columns are replaced by parameters
+struct PlanCacheEntry {
+	//! The prepared statement of the parameterized query, or nullptr if the query cannot be cached
+	shared_ptr<PreparedStatementData> prepared;
+	//! The version of the temporary catalog of the connection when the query was planned
+	optional_idx temp_catalog_version;
+	//! The number of times the entry was used
+	idx_t hits = 0;
+	//! When the entry was used last (for eviction)
+	idx_t last_used = 0;
+};
+
+//! A snapshot of an entry of the plan cache
+struct PlanCacheInfo {
+	string query;
+	bool cacheable;
+	idx_t parameter_count;
+	idx_t hits;
+};
+
+//! The PlanCache keeps the plans of recently executed queries, so queries that only differ in their constants can skip
+//! parsing, binding, optimizing and planning. Plans are bound against the catalog, search path and settings of a
+//! connection, so entries are kept per connection, but they share the capacity and metrics of the database
+class PlanCache {
+public:
+	PlanCache();
+
+	static PlanCache &Get(ClientContext &context);
+
+	//! Replaces the constants that are compared with columns in the WHERE clauses of a SELECT statement with
+	//! parameters. Returns the parameterized statement, the extracted constants are added to "values"
+	static unique_ptr<SQLStatement> Parameterize(const SQLStatement &statement, vector<Value> &values);
+	//! Converts the extracted constants to the types of the parameters of a cached plan. Returns false if a constant
+	//! can not be used for its parameter without changing the meaning of the query.
+	static bool BindParameters(ClientContext &context, PreparedStatementData &prepared, const vector<Value> &values,
+	                           case_insensitive_map_t<BoundParameterData> &result);
+
+	//! Looks up the entry of a parameterized query of the connection
+	shared_ptr<PlanCacheEntry> Lookup(ClientContext &context, const string &query);
+	//! Adds the entry of a parameterized query of the connection, evicting the least recently used entry if needed
+	void Insert(ClientContext &context, const string &query, shared_ptr<PlanCacheEntry> entry);
+	//! Removes the entry of a parameterized query of the connection
+	void Erase(ClientContext &context, const string &query);
+	//! Removes all entries of the connection
+	void RemoveConnection(ClientContext &context);
+	//! Removes all entries
+	void Clear();
+
+	//! Returns the entries of all connections
+	vector<PlanCacheInfo> GetEntries();
+
+private:
+	mutex lock;
+	//! The entries of every connection, by parameterized query
+	reference_map_t<ClientContext, unordered_map<string, shared_ptr<PlanCacheEntry>>> connections;
+	//! The total number of entries
+	idx_t entry_count;
+	//! Logical clock used to find the least recently used entry
+	idx_t clock;
+};
+
+} // namespace duckdb
@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -45,6 +46,10 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! Whether the result only depends on the data of the tables the statement scans (and can be cached)
+	bool result_cacheable = false;
+	//! The tables the result depends on
+	vector<shared_ptr<DataTableInfo>> result_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
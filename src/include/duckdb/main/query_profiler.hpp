@@ -114,6 +114,8 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Adds information that is only known at runtime (e.g., an adaptive decision) to the extra info of an operator
+	DUCKDB_API void AddToExtraInfo(const PhysicalOperator &phys_op, const string &key, const string &value);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class MaterializedQueryResult;
+class PreparedStatementData;
+class SQLStatement;
+struct DataTableInfo;
+
+//! A table that a cached result was computed from
+struct ResultCacheTable {
+	shared_ptr<DataTableInfo> info;
+	//! The commit id of the last change to the table that is included in the result
+	transaction_t commit_id;
+};
+
+//! A cached result of a query
+struct ResultCacheEntry {
+	//! The query
+	string query;
+	//! The tables the result was computed from
+	vector<ResultCacheTable> tables;
+	//! The catalogs the query was bound against
+	unordered_map<string, StatementProperties::CatalogIdentity> read_databases;
+	//! The result types
+	vector<LogicalType> types;
+	//! The result, or nullptr if the result is not stored yet
+	unique_ptr<ColumnDataCollection> collection;
+	//! The memory used by the result
+	idx_t size = 0;
+	//! The number of times the result was used
+	idx_t hits = 0;
+	//! When the result was used last (for eviction)
+	idx_t last_used = 0;
+};
+
+//! A snapshot of an entry of the result cache
+struct ResultCacheInfo {
+	string query;
+	idx_t row_count;
+	idx_t memory_usage;
+	idx_t hits;
+};
+
+//! The ResultCache keeps the results of read-only queries whose result only depends on the data of the tables they
+//! scan. Results are shared by all connections, and are used as long as none of the tables they depend on has been
+//! changed since.
+class ResultCache {
+public:
+	ResultCache();
+
+	static ResultCache &Get(ClientContext &context);
+
+	//! Collects the tables the result of a bound plan depends on. Returns false if the result of the plan can not be
+	//! cached, i.e. if it scans anything other than tables or if any of its expressions is not consistent.
+	static bool GetDependencies(LogicalOperator &plan, vector<shared_ptr<DataTableInfo>> &tables);
+	//! Returns the key of a statement, including the settings and variables of the connection that it is bound with
+	static string GetKey(ClientContext &context, const SQLStatement &statement);
+	//! Creates an (empty) entry for the result of a prepared statement in the current transaction. Returns nullptr if
+	//! the transaction does not see the latest changes to the tables of the statement.
+	static shared_ptr<ResultCacheEntry> CreateEntry(ClientContext &context, const string &query,
+	                                                PreparedStatementData &prepared);
+	//! Creates a prepared statement that scans the result of a cache entry
+	static shared_ptr<PreparedStatementData> CreateScan(PreparedStatementData &prepared, ResultCacheEntry &entry);
+
+	//! Looks up the result of a query. Returns nullptr if there is no cached result with the same tables and versions
+	//! as the entry of the current execution.
+	shared_ptr<ResultCacheEntry> Lookup(const string &key, const ResultCacheEntry &current);
+	//! Stores the result of a query, evicting the least recently used results if the cache is full
+	void Insert(ClientContext &context, const string &key, shared_ptr<ResultCacheEntry> entry,
+	            MaterializedQueryResult &result);
+	//! Removes all results
+	void Clear();
+
+	//! Returns the cached results
+	vector<ResultCacheInfo> GetEntries();
+
+private:
+	void EraseInternal(unordered_map<string, shared_ptr<ResultCacheEntry>>::iterator entry);
+
+private:
+	mutex lock;
+	//! The cached results by key
+	unordered_map<string, shared_ptr<ResultCacheEntry>> entries;
+	//! The memory used by the cached results
+	idx_t memory_usage;
+	//! Logical clock used to find the least recently used result
+	idx_t clock;
+};
+
+} // namespace duckdb
@@ -339,6 +339,26 @@ struct EnableObjectCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableQueryAdmissionSetting {
+	static constexpr const char *Name = "enable_query_admission";
+	static constexpr const char *Description = "Whether queries wait until their estimated memory fits next to the "
+	                                           "estimated memory of the running queries before they start";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryAdmissionTimeoutSetting {
+	static constexpr const char *Name = "query_admission_timeout";
+	static constexpr const char *Description =
+	    "Sets the time (in milliseconds) a query waits for admission before it starts regardless of its memory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StorageCompatibilityVersion {
 	static constexpr const char *Name = "storage_compatibility_version";
 	static constexpr const char *Description = "Serialize on checkpoint with compatibility for a given duckdb version";
@@ -557,6 +577,16 @@ struct MaximumTempDirectorySize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MaximumQueryThreadsSetting {
+	static constexpr const char *Name = "max_query_threads";
+	static constexpr const char *Description =
+	    "The maximum number of threads that concurrently execute tasks of a single query (0 for no limit)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MergeJoinThreshold {
 	static constexpr const char *Name = "merge_join_threshold";
 	static constexpr const char *Description = "The number of rows we need on either table to choose a merge join";
@@ -674,6 +704,17 @@ struct PivotLimitSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PlanCacheSizeSetting {
+	static constexpr const char *Name = "plan_cache_size";
+	static constexpr const char *Description =
+	    "The maximum number of plans of repeated queries that are cached, with their constants replaced by parameters "
+	    "(0 disables the plan cache)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -705,6 +746,16 @@ struct ArrowOutputListView {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ArrowStreamingResults {
+	static constexpr const char *Name = "arrow_streaming_results";
+	static constexpr const char *Description =
+	    "If Arrow result streams (ADBC) are produced by the pipeline threads, instead of from a materialized result";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ProduceArrowStringView {
 	static constexpr const char *Name = "produce_arrow_string_view";
 	static constexpr const char *Description =
@@ -744,6 +795,38 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The share of the threads that queries of this connection get relative to other running queries";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ReoptimizationThresholdSetting {
+	static constexpr const char *Name = "reoptimization_threshold";
+	static constexpr const char *Description =
+	    "Re-plan a query when the observed size of a hash join build side is off from its estimate by more than this "
+	    "factor (0 disables re-optimization)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ResultCacheSizeSetting {
+	static constexpr const char *Name = "result_cache_size";
+	static constexpr const char *Description =
+	    "The maximum memory of the cached results of queries that only depend on the tables they read, e.g. 1GB "
+	    "(0 disables the result cache)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -819,6 +902,17 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SchedulerWorkStealingSetting {
+	static constexpr const char *Name = "scheduler_work_stealing";
+	static constexpr const char *Description =
+	    "Whether rescheduled and follow-up tasks are queued on the thread that last executed or scheduled them, where "
+	    "idle threads can steal them.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
@@ -17,6 +17,7 @@
 
 namespace duckdb {
 
+class ArrowArrayWrapper;
 class ClientContext;
 class ClientContextLock;
 class Executor;
@@ -46,6 +47,10 @@ public:
 	DUCKDB_API StreamExecutionResult ExecuteTask();
 	//! Fetches a DataChunk from the query result.
 	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Whether or not the result is streamed as Arrow record batches (see PhysicalBufferedArrowCollector)
+	DUCKDB_API bool ProducesArrowArrays() const;
+	//! Fetches the next Arrow record batch from a result that ProducesArrowArrays, returns nullptr when finished
+	DUCKDB_API unique_ptr<ArrowArrayWrapper> FetchArrowArray();
 	//! Converts the QueryResult to a string
 	DUCKDB_API string ToString() override;
 	//! Materializes the query result and turns it into a materialized query result
@@ -62,6 +67,8 @@ public:
 private:
 	StreamExecutionResult ExecuteTaskInternal(ClientContextLock &lock);
 	unique_ptr<DataChunk> FetchInternal(ClientContextLock &lock);
+	//! Replenishes the buffer and calls "scan", which returns false if the result is exhausted
+	void FetchBufferedInternal(ClientContextLock &lock, const std::function<bool()> &scan);
 	unique_ptr<ClientContextLock> LockContext();
 	void CheckExecutableInternal(ClientContextLock &lock);
 	bool IsOpenInternal(ClientContextLock &lock);
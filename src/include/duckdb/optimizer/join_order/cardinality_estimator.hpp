@@ -108,6 +108,9 @@ public:
 	//! distinct count selectivities and multiplicities. Hence the template
 	template <class T>
 	T EstimateCardinalityWithSet(JoinRelationSet &new_set);
+	//! Overrides the estimated cardinality of a set of relations, e.g. with a cardinality that was observed during
+	//! execution
+	void SetCardinality(JoinRelationSet &set, double cardinality);
 
 	//! used for debugging.
 	void AddRelationNamesToTdoms(vector<RelationStats> &stats);
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+class LogicalOperator;
+
+//! The cardinality of a sub-plan that was observed during execution
+struct ObservedCardinality {
+	//! The (sorted) table indexes of the leaf operators of the sub-plan, which identify it across re-planning
+	vector<idx_t> table_indexes;
+	//! The number of rows the sub-plan produced
+	idx_t cardinality;
+};
+
+//! CardinalityFeedback collects the cardinalities observed at the pipeline breakers of a query. When an observed
+//! cardinality is off from its estimate by more than the reoptimization_threshold, execution is aborted and the query
+//! is planned again, with the join order optimizer using the observed cardinalities instead of its estimates.
+class CardinalityFeedback {
+public:
+	explicit CardinalityFeedback(double threshold);
+
+	//! The maximum number of times a query is re-planned
+	static constexpr const idx_t MAX_RESTARTS = 4;
+
+	//! Returns the table indexes of the leaf operators of "op"
+	static vector<idx_t> GetLeafTableIndexes(LogicalOperator &op);
+
+	//! Records the observed cardinality of a sub-plan. Returns true (and requests a restart) if the observation
+	//! deviates from the estimate by more than the threshold, and the sub-plan was not observed before
+	bool Observe(const vector<idx_t> &table_indexes, idx_t estimated_cardinality, idx_t cardinality);
+	//! Returns the cardinalities observed so far
+	vector<ObservedCardinality> GetObservedCardinalities();
+
+	//! Whether or not an observation requested the query to be planned again
+	bool RestartRequested();
+	//! Called when the query is planned again
+	void Restart();
+
+private:
+	mutex lock;
+	double threshold;
+	vector<ObservedCardinality> observed;
+	bool restart_requested;
+	idx_t restarts;
+};
+
+} // namespace duckdb
@@ -77,6 +77,10 @@ private:
 	bool SolveJoinOrderExactly();
 	//! Solve the join order approximately using a greedy algorithm
 	void SolveJoinOrderApproximately();
+	//! Replaces the estimated cardinalities of relations, and sets of relations, by the cardinalities that were
+	//! observed before the query was re-optimized
+	void ApplyCardinalityFeedback(vector<RelationStats> &relation_stats,
+	                              vector<pair<reference<JoinRelationSet>, idx_t>> &observed_sets);
 };
 
 } // namespace duckdb
@@ -60,6 +60,8 @@ public:
 	void AddAggregateOrWindowRelation(LogicalOperator &op, optional_ptr<LogicalOperator> parent,
 	                                  const RelationStats &stats, LogicalOperatorType op_type);
 	vector<unique_ptr<SingleJoinRelation>> GetRelations();
+	//! Returns the operator of the relation with the given relation number
+	LogicalOperator &GetRelationOperator(idx_t relation_id);
 
 	const vector<RelationStats> GetRelationStats();
 	//! A mapping of base table index -> index into relations array (relation number)
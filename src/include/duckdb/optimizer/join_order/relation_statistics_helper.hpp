@@ -13,6 +13,8 @@
 namespace duckdb {
 
 class CardinalityEstimator;
+class ColumnHistogram;
+struct ColumnDependency;
 
 struct DistinctCount {
 	idx_t distinct_count;
@@ -40,9 +42,22 @@ struct RelationStats {
 	}
 };
 
+//! The selectivity of the filters on a single column, as estimated with the histogram of the column
+struct FilterSelectivity {
+	//! The column id of the filtered column
+	column_t column_index = 0;
+	//! The physical index of the filtered column
+	idx_t storage_index = 0;
+	double selectivity = 1;
+	//! Whether or not the column is filtered on a single value
+	bool is_equality = false;
+};
+
 class RelationStatisticsHelper {
 public:
 	static constexpr double DEFAULT_SELECTIVITY = 0.2;
+	//! The maximum number of filters that is combined using exponential backoff
+	static constexpr idx_t MAX_BACKOFF_FILTERS = 4;
 
 public:
 	static idx_t InspectConjunctionAND(idx_t cardinality, idx_t column_index, ConjunctionAndFilter &filter,
@@ -69,6 +84,14 @@ public:
 	static void CopyRelationStats(RelationStats &to, const RelationStats &from);
 
 private:
+	//! Estimates the selectivity of the filters on a column, using the histogram of the column
+	static bool TryEstimateSelectivity(TableFilter &filter, const ColumnHistogram &histogram,
+	                                   BaseStatistics &base_stats, FilterSelectivity &result);
+	//! Combines the selectivities of filters on different columns, taking the dependencies between them into account
+	static double CombineSelectivities(vector<FilterSelectivity> &filters, vector<ColumnDependency> dependencies);
+	//! Updates the distinct counts of the columns of a relation after filtering
+	static void UpdateDistinctCounts(RelationStats &stats, const vector<column_t> &column_ids,
+	                                 const vector<FilterSelectivity> &filters, idx_t cardinality);
 };
 
 } // namespace duckdb
@@ -60,6 +60,8 @@ public:
 
 	//! Registers the task in the interrupt_state to allow Source/Sink operators to block the task
 	void SetTaskForInterrupts(weak_ptr<Task> current_task);
+	//! Registers a signal in the interrupt_state, for pipelines that are executed without a task
+	void SetSignalForInterrupts(weak_ptr<InterruptDoneSignalState> done_signal);
 
 private:
 	//! The pipeline to process
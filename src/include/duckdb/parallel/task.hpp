@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -50,6 +51,11 @@ public:
 	virtual bool TaskBlockedOnResult() const {
 		return false;
 	}
+
+public:
+	//! The scheduler thread that last executed the task before it was blocked
+	//! When the task is rescheduled it is queued on that thread, which still has the task's data in its caches
+	optional_idx worker_hint;
 };
 
 } // namespace duckdb
@@ -11,6 +11,8 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -23,14 +25,64 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerQueue;
+
+//! The scheduling state of the tasks of a single producer (usually a query)
+struct ProducerQueueInfo {
+	//! The fixed-point scale of the strides, a producer with priority p advances its virtual time by SCALE / p
+	static constexpr const idx_t STRIDE_SCALE = idx_t(1) << 20;
+
+	ProducerQueueInfo(unique_ptr<QueueProducerToken> token, idx_t producer_id, optional_idx query_id, idx_t priority,
+	                  idx_t max_threads);
+	~ProducerQueueInfo();
+
+	//! Whether the producer has to go through the fair scheduling path (a priority or a thread limit)
+	bool IsWeighted() const;
+	//! The amount by which the virtual time of the producer advances for every task it gets
+	idx_t Stride() const;
+
+	//! Unique identifier of the producer
+	const idx_t producer_id;
+	//! The query that created the producer, if any
+	const optional_idx query_id;
+	//! The share of the threads the producer gets relative to the other producers with tasks
+	const idx_t priority;
+	//! The maximum number of tasks of the producer that threads execute concurrently (0 = no limit)
+	const idx_t max_threads;
+	//! The token of the producer in the shared queue
+	unique_ptr<QueueProducerToken> token;
+	//! Serializes the enqueues and dequeues of the producer token
+	mutex producer_lock;
+	//! The number of scheduled tasks in the shared queue that have not been picked up yet
+	atomic<idx_t> pending_tasks;
+	//! The number of scheduled tasks in the local queues of the threads that have not been picked up yet
+	atomic<idx_t> local_tasks;
+	//! The number of tasks that are currently being executed by the scheduler
+	atomic<idx_t> active_tasks;
+	//! The number of tasks that were completed by the scheduler
+	atomic<idx_t> completed_tasks;
+	//! The virtual time of the producer, advanced by its stride for every task it gets
+	atomic<idx_t> pass;
+};
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, shared_ptr<ProducerQueueInfo> info);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
-	unique_ptr<QueueProducerToken> token;
-	mutex producer_lock;
+	shared_ptr<ProducerQueueInfo> info;
+};
+
+//! A snapshot of the scheduling state of a producer
+struct ProducerQueueStatus {
+	idx_t producer_id;
+	optional_idx query_id;
+	idx_t priority;
+	idx_t max_threads;
+	idx_t pending_tasks;
+	idx_t local_tasks;
+	idx_t active_tasks;
+	idx_t completed_tasks;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
@@ -38,6 +90,8 @@ class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
+	friend struct ProducerToken;
+
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
 	~TaskScheduler();
@@ -46,12 +100,16 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer for the tasks of a query, using the scheduling settings of the client
+	unique_ptr<ProducerToken> CreateProducer(ClientContext &context);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
 	void ExecuteForever(atomic<bool> *marker);
+	//! Run tasks forever as a background thread of the scheduler, using the local task queue of the thread
+	void ExecuteForever(atomic<bool> *marker, optional_ptr<WorkerQueue> worker);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -78,19 +136,56 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Sets whether tasks are queued locally on the thread that produced them or last executed them
+	void SetWorkStealing(bool enable);
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
 	static idx_t GetEstimatedCPUId();
 
+	//! Returns the scheduling state of all producers
+	vector<ProducerQueueStatus> GetQueueStatus();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
+	unique_ptr<ProducerToken> CreateProducer(optional_idx query_id, idx_t priority, idx_t max_threads);
+	void RemoveProducer(ProducerToken &producer);
+	//! Fetches the next task of the worker, the producer with the lowest virtual time that is below its thread limit,
+	//! or a task stolen from the local queue of another worker - in that order
+	bool DequeueTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info, optional_ptr<WorkerQueue> worker);
+	//! Fetches a task of the producer with the lowest virtual time that is below its thread limit
+	//! Sets "any_pending" if any producer has tasks in the shared queue
+	bool DequeueFairTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info, bool &any_pending);
+	//! Steals the oldest task from the local queue of another worker (requires the queue lock)
+	bool StealTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info, optional_ptr<WorkerQueue> worker,
+	               optional_ptr<ProducerQueueInfo> producer);
+	//! Executes a task fetched by DequeueTask
+	TaskExecutionResult ExecuteTask(shared_ptr<Task> &task, const shared_ptr<ProducerQueueInfo> &info,
+	                                optional_ptr<WorkerQueue> worker);
+
 private:
 	DatabaseInstance &db;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! Lock for the registry of producers and the local task queues
+	mutex queue_lock;
+	//! The producers that can currently schedule tasks
+	vector<shared_ptr<ProducerQueueInfo>> producers;
+	//! The next producer id
+	idx_t producer_id;
+	//! The number of producers with a priority or a thread limit, if there are none tasks are dequeued lock-free
+	atomic<idx_t> weighted_producers;
+	//! The virtual time of the last dequeued task, producers that were idle restart from here
+	atomic<idx_t> virtual_time;
+	//! The number of tasks in the local queues of the threads, threads only look for tasks to steal if there are any
+	atomic<idx_t> local_task_count;
+	//! The local task queues of the background threads, indexed by thread (protected by the queue lock)
+	//! Queues are kept when threads are stopped, so their remaining tasks can still be picked up
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	//! Whether rescheduled tasks are queued locally on the thread that last executed them
+	atomic<bool> work_stealing;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
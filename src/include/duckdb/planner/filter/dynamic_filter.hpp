@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter: the constant comparison that is currently in effect (if any)
+struct DynamicFilterData {
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	mutex lock;
+	//! The comparison type of the filter
+	ExpressionType comparison_type;
+	//! The current filter - only valid if "initialized" is set
+	unique_ptr<ConstantFilter> filter;
+	bool initialized = false;
+
+	//! Set the constant of the filter - NULL values are ignored
+	void SetValue(Value val);
+	//! Reset the filter to its uninitialized state
+	void Reset();
+};
+
+//! DynamicFilter is a filter whose constant is only known (and tightened) while the query runs, e.g. the boundary
+//! value of a Top-N. Until a value has been set, the filter lets all rows through. Note that the filter can only ever
+//! become more selective, so the scan cannot label it as "always true" for a whole row group.
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared, mutable filter data
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -88,6 +88,8 @@ public:
 	idx_t window_index;
 	//! Window functions to compute (only used if HasWindow is true)
 	vector<unique_ptr<Expression>> windows;
+	//! Map from window function to window index (used to eliminate duplicate windows)
+	expression_map_t<idx_t> window_map;
 
 	//! Unnest expression
 	unordered_map<idx_t, BoundUnnestNode> unnests;
@@ -182,6 +182,14 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Get the histogram of a physical column within the table (if any)
+	shared_ptr<ColumnHistogram> GetHistogram(column_t column_id);
+	//! Sets the histogram of a physical column within the table
+	void SetHistogram(column_t column_id, shared_ptr<ColumnHistogram> histogram);
+	//! Get the functional dependencies between the physical columns of the table
+	vector<ColumnDependency> GetColumnDependencies();
+	//! Sets the functional dependencies between the physical columns of the table
+	void SetColumnDependencies(vector<ColumnDependency> dependencies);
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/column_dependency.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+
+//! ColumnDependency describes a (soft) functional dependency between two columns of a table: the degree is the fraction
+//! of the rows for which the value of the "determinant" column determines the value of the "dependent" column.
+struct ColumnDependency {
+	//! The (physical) index of the determining column
+	idx_t determinant;
+	//! The (physical) index of the dependent column
+	idx_t dependent;
+	//! The degree of the dependency, between 0 and 1
+	double degree;
+
+public:
+	//! The maximum number of columns for which the dependencies between all pairs of columns are computed
+	static constexpr const idx_t MAX_COLUMNS = 16;
+	//! Dependencies with a lower degree are not kept
+	static constexpr const double MIN_DEGREE = 0.5;
+
+	//! Computes the dependencies between the given columns, based on the hashes of a sample of "count" rows
+	static vector<ColumnDependency> Compute(const vector<idx_t> &columns, const vector<vector<hash_t>> &hashes,
+	                                        idx_t count);
+
+	void Serialize(Serializer &serializer) const;
+	static ColumnDependency Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
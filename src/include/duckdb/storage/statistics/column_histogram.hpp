@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/column_histogram.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/vector_size.hpp"
+
+namespace duckdb {
+class Vector;
+class Serializer;
+class Deserializer;
+
+//! A value that occurs frequently in a column
+struct MostCommonValue {
+	//! The hash of the value
+	hash_t hash;
+	//! The value converted to a double, only set for types that support histogram buckets
+	double value;
+	//! The fraction of the rows of the table that have this value
+	double frequency;
+
+	void Serialize(Serializer &serializer) const;
+	static MostCommonValue Deserialize(Deserializer &deserializer);
+};
+
+//! ColumnHistogram describes the distribution of the values of a column, based on a sample of its rows. It holds the
+//! most common values of the column, and an equi-depth histogram over the remaining values (for numeric and temporal
+//! types). Both are used to estimate the selectivity of filters on the column.
+class ColumnHistogram {
+public:
+	ColumnHistogram();
+
+	//! The number of rows that is sampled to build the histogram
+	static constexpr const idx_t SAMPLE_SIZE = STANDARD_VECTOR_SIZE;
+	//! The maximum number of most common values that are kept
+	static constexpr const idx_t MAX_MOST_COMMON_VALUES = 32;
+	//! The maximum number of buckets of the histogram
+	static constexpr const idx_t MAX_BUCKETS = 64;
+
+	//! The fraction of the rows that is NULL
+	double null_fraction;
+	//! The most common values, ordered by descending frequency
+	vector<MostCommonValue> most_common_values;
+	//! The bucket boundaries of the equi-depth histogram over all values that are not a most common value
+	vector<double> bounds;
+
+public:
+	//! Builds a histogram from a sample of "count" values of a column, and the hashes of these values
+	static unique_ptr<ColumnHistogram> Create(Vector &sample, Vector &hashes, idx_t count);
+
+	static bool TypeIsSupported(const LogicalType &type);
+	//! Whether or not the histogram can have buckets for values of the given type
+	static bool TypeHasBuckets(const LogicalType &type);
+	//! Converts a value to the double that is used in the buckets
+	static bool TryGetBucketValue(const Value &value, double &result);
+
+	//! Estimates the fraction of the rows for which "column = constant" holds, given the distinct count of the column
+	double EstimateEquality(const Value &constant, idx_t distinct_count) const;
+	//! Estimates the fraction of the rows for which the column lies between the (optional) bounds
+	bool TryEstimateRange(const Value *lower, bool lower_inclusive, const Value *upper, bool upper_inclusive,
+	                      double &result) const;
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<ColumnHistogram> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The fraction of the values that are not a most common value and that are smaller than (or equal to) "value"
+	double BucketFraction(double value) const;
+	double MostCommonFrequency() const;
+};
+
+} // namespace duckdb
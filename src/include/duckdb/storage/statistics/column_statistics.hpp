@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/column_histogram.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -32,6 +33,9 @@ public:
 	DistinctStatistics &DistinctStats();
 	void SetDistinct(unique_ptr<DistinctStatistics> distinct_stats);
 
+	shared_ptr<ColumnHistogram> GetHistogram() const;
+	void SetHistogram(shared_ptr<ColumnHistogram> histogram);
+
 	shared_ptr<ColumnStatistics> Copy() const;
 
 	void Serialize(Serializer &serializer) const;
@@ -41,6 +45,8 @@ private:
 	BaseStatistics stats;
 	//! The approximate count distinct stats of the column
 	unique_ptr<DistinctStatistics> distinct_stats;
+	//! The histogram of the column, built by ANALYZE
+	shared_ptr<ColumnHistogram> histogram;
 };
 
 } // namespace duckdb
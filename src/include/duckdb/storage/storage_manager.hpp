@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -83,6 +84,11 @@ public:
 	bool IsLoaded() const {
 		return load_complete;
 	}
+	//! Marks that statistics were changed without writing to the WAL (e.g. by ANALYZE), so that the next checkpoint
+	//! writes them even if the WAL is empty
+	void SetStatisticsChanged() {
+		statistics_changed = true;
+	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
 	bool InMemory();
@@ -110,6 +116,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Whether or not there are statistics that are only persisted by a checkpoint
+	atomic<bool> statistics_changed {false};
 
 public:
 	template <class TARGET>
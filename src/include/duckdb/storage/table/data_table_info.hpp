@@ -49,6 +49,23 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Returns the commit id of the last transaction that changed the data of the table (or 0)
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	//! Called when a transaction that changed the data of the table commits
+	void SetLastCommitId(transaction_t commit_id) {
+		last_commit_id = commit_id;
+	}
+	//! Returns a counter that is incremented whenever committed rows of the table are deleted or updated, or the row
+	//! ids of the table are reassigned by a vacuum
+	idx_t GetRowChangeCount() const {
+		return row_change_count;
+	}
+	void IncrementRowChangeCount() {
+		row_change_count++;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +83,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that changed the data of the table
+	atomic<transaction_t> last_commit_id;
+	//! The number of deletes, updates and vacuums of the table
+	atomic<idx_t> row_change_count;
 };
 
 } // namespace duckdb
@@ -112,6 +112,10 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	shared_ptr<ColumnHistogram> GetHistogram(column_t column_id);
+	void SetHistogram(column_t column_id, shared_ptr<ColumnHistogram> histogram);
+	vector<ColumnDependency> GetColumnDependencies();
+	void SetColumnDependencies(vector<ColumnDependency> dependencies);
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
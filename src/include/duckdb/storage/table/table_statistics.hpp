@@ -13,6 +13,7 @@
 #include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
+#include "duckdb/storage/statistics/column_dependency.hpp"
 
 namespace duckdb {
 class ColumnList;
@@ -49,6 +50,9 @@ public:
 	//! The reference can only be safely accessed while the lock is held
 	ColumnStatistics &GetStats(TableStatisticsLock &lock, idx_t i);
 
+	vector<ColumnDependency> GetColumnDependencies();
+	void SetColumnDependencies(vector<ColumnDependency> dependencies);
+
 	bool Empty();
 
 	unique_ptr<TableStatisticsLock> GetLock();
@@ -61,6 +65,8 @@ private:
 	shared_ptr<mutex> stats_lock;
 	//! Column statistics
 	vector<shared_ptr<ColumnStatistics>> column_stats;
+	//! The functional dependencies between the columns, built by ANALYZE
+	vector<ColumnDependency> column_dependencies;
 	//! The table sample
 	//! Sample for table
 	unique_ptr<BlockingSample> table_sample;
@@ -9,10 +9,14 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -59,12 +63,62 @@ private:
 	atomic<idx_t> materialization_penalty;
 };
 
+//! Admission of a query by the TemporaryMemoryManager
+//! As long as this is within scope, the estimated memory of the query counts towards the admitted memory
+class QueryAdmissionState {
+	friend class TemporaryMemoryManager;
+
+private:
+	QueryAdmissionState(TemporaryMemoryManager &temporary_memory_manager, optional_idx query_id, string query,
+	                    idx_t estimated_memory);
+
+public:
+	~QueryAdmissionState();
+
+public:
+	//! Get the estimated memory of the query
+	idx_t GetEstimatedMemory() const;
+	//! Whether the query was admitted because it waited for longer than the timeout, rather than because it fit
+	bool TimedOut() const;
+
+private:
+	//! The TemporaryMemoryManager that owns this state
+	TemporaryMemoryManager &temporary_memory_manager;
+
+	//! The query that is admitted
+	const optional_idx query_id;
+	const string query;
+	//! The memory the query is estimated to need
+	const idx_t estimated_memory;
+	//! When the query started waiting for admission
+	const std::chrono::steady_clock::time_point wait_start;
+
+	//! Whether the query has been admitted (protected by the lock of the TemporaryMemoryManager)
+	bool admitted;
+	//! Whether the query was admitted after the timeout (protected by the lock of the TemporaryMemoryManager)
+	bool timed_out;
+	//! How long the query waited for admission (protected by the lock of the TemporaryMemoryManager)
+	std::chrono::steady_clock::duration wait_time;
+};
+
+//! A snapshot of the admission state of a query
+struct QueryAdmissionInfo {
+	optional_idx query_id;
+	string query;
+	idx_t estimated_memory;
+	bool admitted;
+	bool timed_out;
+	//! How long the query has waited for admission, in milliseconds
+	idx_t wait_time;
+};
+
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
 //! to concurrent states, such that their combined memory usage does not exceed the limit
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
 	friend class TemporaryMemoryState;
+	friend class QueryAdmissionState;
 
 public:
 	TemporaryMemoryManager();
@@ -88,12 +142,19 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Admit a query that is estimated to need "estimated_memory". Waits until this fits in the memory limit next to
+	//! the estimated memory of the already admitted queries, or until the admission timeout has passed
+	unique_ptr<QueryAdmissionState> AdmitQuery(ClientContext &context, idx_t estimated_memory);
+	//! Get the admission state of the queries that are waiting or admitted
+	vector<QueryAdmissionInfo> GetQueryAdmissions();
 
 private:
 	//! Locks the TemporaryMemoryManager
 	unique_lock<mutex> Lock();
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Release the estimated memory of a query (called by the destructor of QueryAdmissionState)
+	void ReleaseQuery(QueryAdmissionState &query_admission_state);
 	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
@@ -127,6 +188,13 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! Queries that are waiting for admission or have been admitted
+	reference_set_t<QueryAdmissionState> query_admissions;
+	//! The sum of the estimated memory of the admitted queries
+	idx_t admitted_memory;
+	//! Signalled when an admitted query releases its memory
+	std::condition_variable admission_released;
 };
 
 } // namespace duckdb
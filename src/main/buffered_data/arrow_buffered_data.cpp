@@ -0,0 +1,152 @@
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/common/stack.hpp"
+
+namespace duckdb {
+
+ArrowBufferedData::ArrowBufferedData(weak_ptr<ClientContext> context)
+    : BufferedData(BufferedData::Type::ARROW, std::move(context)), buffer_byte_count(0), read_queue_byte_count(0),
+      min_batch(0) {
+	read_queue_capacity = (idx_t)(static_cast<double>(total_buffer_size) * 0.6);
+	buffer_capacity = (idx_t)(static_cast<double>(total_buffer_size) * 0.4);
+}
+
+void ArrowBufferedData::BlockSink(const InterruptState &blocked_sink, idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	D_ASSERT(!blocked_sinks.count(batch));
+	blocked_sinks.emplace(batch, blocked_sink);
+}
+
+bool ArrowBufferedData::ShouldBlockBatch(idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	if (batch == min_batch) {
+		// If there is room in the read queue, we want to process the minimum batch
+		return read_queue_byte_count >= ReadQueueCapacity();
+	}
+	return buffer_byte_count >= BufferCapacity();
+}
+
+bool ArrowBufferedData::BufferIsEmpty() {
+	lock_guard<mutex> lock(glock);
+	return read_queue.empty();
+}
+
+void ArrowBufferedData::UnblockSinks() {
+	lock_guard<mutex> lock(glock);
+	stack<idx_t> to_remove;
+	for (auto &entry : blocked_sinks) {
+		auto batch = entry.first;
+		if (batch == min_batch) {
+			if (read_queue_byte_count >= ReadQueueCapacity()) {
+				continue;
+			}
+		} else if (buffer_byte_count >= BufferCapacity()) {
+			continue;
+		}
+		entry.second.Callback();
+		to_remove.push(batch);
+	}
+	while (!to_remove.empty()) {
+		blocked_sinks.erase(to_remove.top());
+		to_remove.pop();
+	}
+}
+
+void ArrowBufferedData::MoveCompletedBatches(lock_guard<mutex> &lock) {
+	// all batches up to and including the minimum batch can be read: lower batches are complete, and the record
+	// batches of the minimum batch are produced in order
+	while (!buffer.empty() && buffer.begin()->first <= min_batch) {
+		auto &arrays = buffer.begin()->second;
+		for (auto &array : arrays) {
+			buffer_byte_count -= array.allocation_size;
+			read_queue_byte_count += array.allocation_size;
+			read_queue.push_back(std::move(array));
+		}
+		buffer.erase(buffer.begin());
+	}
+}
+
+void ArrowBufferedData::UpdateMinBatchIndex(idx_t min_batch_index) {
+	lock_guard<mutex> lock(glock);
+	if (min_batch_index <= min_batch) {
+		// No change, early out
+		return;
+	}
+	min_batch = min_batch_index;
+	MoveCompletedBatches(lock);
+}
+
+StreamExecutionResult ArrowBufferedData::ExecuteTaskInternal(StreamQueryResult &result,
+                                                             ClientContextLock &context_lock) {
+	auto cc = context.lock();
+	if (!cc) {
+		return StreamExecutionResult::EXECUTION_CANCELLED;
+	}
+
+	if (!BufferIsEmpty()) {
+		// The buffer isn't empty yet, just return
+		return StreamExecutionResult::CHUNK_READY;
+	}
+	// Unblock any pending sinks if the buffer isnt full
+	UnblockSinks();
+	// Let the executor run until the buffer is no longer empty
+	auto execution_result = cc->ExecuteTaskInternal(context_lock, result);
+	if (!BufferIsEmpty()) {
+		return StreamExecutionResult::CHUNK_READY;
+	}
+	if (execution_result == PendingExecutionResult::BLOCKED ||
+	    execution_result == PendingExecutionResult::RESULT_READY) {
+		return StreamExecutionResult::BLOCKED;
+	}
+	if (result.HasError()) {
+		Close();
+	}
+	switch (execution_result) {
+	case PendingExecutionResult::NO_TASKS_AVAILABLE:
+	case PendingExecutionResult::RESULT_NOT_READY:
+		return StreamExecutionResult::CHUNK_NOT_READY;
+	case PendingExecutionResult::EXECUTION_FINISHED:
+		return StreamExecutionResult::EXECUTION_FINISHED;
+	case PendingExecutionResult::EXECUTION_ERROR:
+		return StreamExecutionResult::EXECUTION_ERROR;
+	default:
+		throw InternalException("No conversion from PendingExecutionResult (%s) -> StreamExecutionResult",
+		                        EnumUtil::ToString(execution_result));
+	}
+}
+
+unique_ptr<DataChunk> ArrowBufferedData::Scan() {
+	throw NotImplementedException("Can't 'Fetch' from a streaming Arrow result, use FetchArrowArray instead");
+}
+
+unique_ptr<ArrowArrayWrapper> ArrowBufferedData::ScanArrow() {
+	lock_guard<mutex> lock(glock);
+	if (read_queue.empty()) {
+		context.reset();
+		D_ASSERT(blocked_sinks.empty());
+		D_ASSERT(buffer.empty());
+		return nullptr;
+	}
+	auto array = std::move(read_queue.front());
+	read_queue.pop_front();
+	read_queue_byte_count -= array.allocation_size;
+	return std::move(array.array);
+}
+
+void ArrowBufferedData::Append(unique_ptr<ArrowArrayWrapper> array, idx_t allocation_size, idx_t batch) {
+	lock_guard<mutex> lock(glock);
+	D_ASSERT(batch >= min_batch);
+	BufferedArrowArray buffered_array {std::move(array), allocation_size};
+	if (batch == min_batch) {
+		// There should not be any batches in the buffer that are lower or equal to the minimum batch index
+		D_ASSERT(buffer.empty() || buffer.begin()->first > min_batch);
+		read_queue_byte_count += allocation_size;
+		read_queue.push_back(std::move(buffered_array));
+	} else {
+		buffer_byte_count += allocation_size;
+		buffer[batch].push_back(std::move(buffered_array));
+	}
+}
+
+} // namespace duckdb
@@ -20,10 +20,13 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/parameter_expression.hpp"
@@ -47,14 +50,20 @@ namespace duckdb {
 
 struct ActiveQueryContext {
 public:
+	//! The cached result that is read, or the entry that the result is stored in
+	shared_ptr<ResultCacheEntry> result_cache_entry;
 	//! The query that is currently being executed
 	string query;
+	//! The key of the query in the result cache, if the result of the query could be cached
+	string result_cache_key;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The cardinalities observed while executing the query (if the query can be re-optimized)
+	unique_ptr<CardinalityFeedback> cardinality_feedback;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -134,7 +143,8 @@ struct DebugClientContextState : public ClientContextState {
 #endif
 
 ClientContext::ClientContext(shared_ptr<DatabaseInstance> database)
-    : db(std::move(database)), interrupted(false), client_data(make_uniq<ClientData>(*this)), transaction(*this) {
+    : db(std::move(database)), interrupted(false), client_data(make_uniq<ClientData>(*this)), transaction(*this),
+      interrupted_by_client(false) {
 	registered_state = make_uniq<RegisteredStateManager>();
 #ifdef DEBUG
 	registered_state->GetOrCreate<DebugClientContextState>("debug_client_context_state");
@@ -142,6 +152,8 @@ ClientContext::ClientContext(shared_ptr<DatabaseInstance> database)
 }
 
 ClientContext::~ClientContext() {
+	// cached plans are kept per connection
+	PlanCache::Get(*this).RemoveConnection(*this);
 	if (Exception::UncaughtException()) {
 		return;
 	}
@@ -287,6 +299,13 @@ const string &ClientContext::GetCurrentQuery() {
 	return active_query->query;
 }
 
+optional_ptr<CardinalityFeedback> ClientContext::GetCardinalityFeedback() {
+	if (!active_query) {
+		return nullptr;
+	}
+	return active_query->cardinality_feedback.get();
+}
+
 unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lock, PendingQueryResult &pending) {
 	D_ASSERT(active_query);
 	D_ASSERT(active_query->IsOpenResult(pending));
@@ -298,6 +317,11 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (active_query->result_cache_entry && result->type == QueryResultType::MATERIALIZED_RESULT &&
+	    !result->HasError()) {
+		ResultCache::Get(*this).Insert(*this, active_query->result_cache_key, active_query->result_cache_entry,
+		                               result->Cast<MaterializedQueryResult>());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -348,6 +372,10 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	if (!planner.properties.bound_all_parameters) {
 		return result;
 	}
+	if (DBConfig::GetConfig(*this).options.result_cache_size > 0 &&
+	    statement_type == StatementType::SELECT_STATEMENT) {
+		result->result_cacheable = ResultCache::GetDependencies(*plan, result->result_tables);
+	}
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
@@ -479,6 +507,18 @@ unique_ptr<PendingQueryResult>
 ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
                                                 const PendingQueryParameters &parameters) {
 	D_ASSERT(active_query);
+	if (!active_query->result_cache_key.empty() && statement_p->result_cacheable) {
+		auto entry = ResultCache::CreateEntry(*this, active_query->query, *statement_p);
+		if (entry) {
+			auto cached = ResultCache::Get(*this).Lookup(active_query->result_cache_key, *entry);
+			if (cached) {
+				// scan the cached result instead of running the query
+				statement_p = ResultCache::CreateScan(*statement_p, *cached);
+				entry = std::move(cached);
+			}
+			active_query->result_cache_entry = std::move(entry);
+		}
+	}
 	auto &statement = *statement_p;
 
 	BindPreparedStatementParameters(statement, parameters);
@@ -501,10 +541,18 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 
 	get_result_collector_t get_method = PhysicalResultCollector::GetResultCollector;
 	auto &client_config = ClientConfig::GetConfig(*this);
-	if (!stream_result && client_config.result_collector) {
+	if (stream_result && client_config.streaming_result_collector) {
+		get_method = client_config.streaming_result_collector;
+	} else if (!stream_result && client_config.result_collector) {
 		get_method = client_config.result_collector;
 	}
 	statement.is_streaming = stream_result;
+	if (client_config.reoptimization_threshold > 0 && !stream_result &&
+	    statement.statement_type == StatementType::SELECT_STATEMENT && statement.properties.IsReadOnly()) {
+		// the query can be aborted and planned again when its cardinalities turn out to be far off from the estimates:
+		// no rows have been handed out before the query finishes, and running it again has no side effects
+		active_query->cardinality_feedback = make_uniq<CardinalityFeedback>(client_config.reoptimization_threshold);
+	}
 	auto collector = get_method(*this, statement);
 	D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
 	executor.Initialize(std::move(collector));
@@ -562,6 +610,9 @@ PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &loc
 		return query_result;
 	} catch (std::exception &ex) {
 		auto error = ErrorData(ex);
+		if (ReoptimizeQuery(lock, error)) {
+			return PendingExecutionResult::RESULT_NOT_READY;
+		}
 		if (error.Type() == ExceptionType::INTERRUPT) {
 			auto &executor = *active_query->executor;
 			if (!executor.HasError()) {
@@ -590,10 +641,53 @@ PendingExecutionResult ClientContext::ExecuteTaskInternal(ClientContextLock &loc
 	return PendingExecutionResult::EXECUTION_ERROR;
 }
 
+bool ClientContext::ReoptimizeQuery(ClientContextLock &lock, ErrorData &error) {
+	auto &feedback = active_query->cardinality_feedback;
+	if (!feedback || !feedback->RestartRequested()) {
+		return false;
+	}
+	// the operator that requested the restart aborts execution with an interrupt - only restart if nothing else
+	// went wrong in the meantime and the query was not interrupted by the client
+	if (error.Type() != ExceptionType::INTERRUPT || interrupted_by_client ||
+	    !active_query->executor->HasOnlyErrorsOfType(ExceptionType::INTERRUPT)) {
+		return false;
+	}
+	feedback->Restart();
+	try {
+		auto &prepared = *active_query->prepared;
+		case_insensitive_map_t<BoundParameterData> parameters;
+		for (auto &entry : prepared.value_map) {
+			parameters.emplace(entry.first, BoundParameterData(entry.second->GetValue()));
+		}
+		// the join order optimizer picks up the observed cardinalities through GetCardinalityFeedback
+		auto new_prepared =
+		    CreatePreparedStatement(lock, active_query->query, prepared.unbound_statement->Copy(), parameters);
+		new_prepared->Bind(std::move(parameters));
+
+		get_result_collector_t get_method = PhysicalResultCollector::GetResultCollector;
+		auto &client_config = ClientConfig::GetConfig(*this);
+		if (client_config.result_collector) {
+			get_method = client_config.result_collector;
+		}
+		new_prepared->is_streaming = false;
+		auto collector = get_method(*this, *new_prepared);
+		D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
+		// restart execution on the same executor, which discards the state of the aborted plan
+		active_query->executor->Initialize(std::move(collector));
+		D_ASSERT(active_query->executor->GetTypes() == prepared.types);
+		active_query->prepared = std::move(new_prepared);
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
+		return false;
+	}
+	return true;
+}
+
 void ClientContext::InitialCleanup(ClientContextLock &lock) {
 	//! Cleanup any open results and reset the interrupted flag
 	CleanupInternal(lock);
 	interrupted = false;
+	interrupted_by_client = false;
 }
 
 vector<unique_ptr<SQLStatement>> ClientContext::ParseStatements(const string &query) {
@@ -731,9 +825,94 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 	return Execute(query, prepared, parameters);
 }
 
+unique_ptr<PendingQueryResult> ClientContext::PendingCachedStatement(ClientContextLock &lock, const string &query,
+                                                                     const SQLStatement &statement,
+                                                                     const PendingQueryParameters &parameters) {
+	auto &db_config = DBConfig::GetConfig(*this);
+	if (db_config.options.plan_cache_size == 0 || config.AnyVerification()) {
+		return nullptr;
+	}
+	if (statement.type != StatementType::SELECT_STATEMENT || statement.n_param > 0 ||
+	    (parameters.parameters && !parameters.parameters->empty())) {
+		return nullptr;
+	}
+	vector<Value> values;
+	auto parameterized = PlanCache::Parameterize(statement, values);
+	if (values.empty()) {
+		return nullptr;
+	}
+	auto &plan_cache = PlanCache::Get(*this);
+	auto key = parameterized->ToString();
+	auto temp_catalog_version = Catalog::GetCatalog(*this, TEMP_CATALOG).GetCatalogVersion(*this);
+
+	case_insensitive_map_t<BoundParameterData> bound_values;
+	auto entry = plan_cache.Lookup(*this, key);
+	if (entry && entry->prepared) {
+		// the plan must be replanned if the catalog (or a temporary object shadowing a table) has changed
+		if (!(entry->temp_catalog_version == temp_catalog_version)) {
+			plan_cache.Erase(*this, key);
+			entry.reset();
+		} else if (!PlanCache::BindParameters(*this, *entry->prepared, values, bound_values)) {
+			// these constants can not be used as parameters of the plan
+			return nullptr;
+		} else if (entry->prepared->RequireRebind(*this, &bound_values)) {
+			plan_cache.Erase(*this, key);
+			entry.reset();
+			bound_values.clear();
+		}
+	}
+	if (!entry) {
+		entry = make_shared_ptr<PlanCacheEntry>();
+		entry->temp_catalog_version = temp_catalog_version;
+		shared_ptr<PreparedStatementData> prepared;
+		try {
+			prepared = CreatePreparedStatement(lock, query, parameterized->Copy());
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (Exception::InvalidatesTransaction(error.Type())) {
+				throw;
+			}
+			// the parameterized query could not be planned - plan the query as-is
+			return nullptr;
+		}
+		prepared->unbound_statement = std::move(parameterized);
+		auto &properties = prepared->properties;
+		if (properties.bound_all_parameters && !properties.always_require_rebind &&
+		    properties.modified_databases.empty() && properties.parameter_count == values.size()) {
+			entry->prepared = std::move(prepared);
+		}
+		// queries that can not be parameterized are remembered as well, so they are not planned twice every time
+		plan_cache.Insert(*this, key, entry);
+		if (!entry->prepared || !PlanCache::BindParameters(*this, *entry->prepared, values, bound_values) ||
+		    entry->prepared->RequireRebind(*this, &bound_values)) {
+			// these constants can not be used as parameters of the plan
+			return nullptr;
+		}
+	}
+	if (!entry->prepared) {
+		return nullptr;
+	}
+	CheckIfPreparedStatementIsExecutable(*entry->prepared);
+	PendingQueryParameters cached_parameters;
+	cached_parameters.parameters = &bound_values;
+	cached_parameters.allow_stream_result = parameters.allow_stream_result;
+	return PendingPreparedStatementInternal(lock, entry->prepared, cached_parameters);
+}
+
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	if (DBConfig::GetConfig(*this).options.result_cache_size > 0 &&
+	    statement->type == StatementType::SELECT_STATEMENT &&
+	    (!parameters.parameters || parameters.parameters->empty()) && transaction.IsAutoCommit() &&
+	    !config.AnyVerification()) {
+		// in auto-commit mode the query sees all committed changes, so its result can be shared
+		active_query->result_cache_key = ResultCache::GetKey(*this, *statement);
+	}
+	auto cached = PendingCachedStatement(lock, query, *statement, parameters);
+	if (cached) {
+		return cached;
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
@@ -1028,6 +1207,7 @@ unique_ptr<QueryResult> ClientContext::ExecutePendingQueryInternal(ClientContext
 }
 
 void ClientContext::Interrupt() {
+	interrupted_by_client = true;
 	interrupted = true;
 }
 
@@ -84,6 +84,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallKnownExtensions),
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
+    DUCKDB_GLOBAL(EnableQueryAdmissionSetting),
+    DUCKDB_GLOBAL(QueryAdmissionTimeoutSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
@@ -106,6 +108,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(StreamingBufferSize),
     DUCKDB_GLOBAL(MaximumMemorySetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
+    DUCKDB_LOCAL(MaximumQueryThreadsSetting),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
     DUCKDB_GLOBAL(OldImplicitCasting),
@@ -116,6 +119,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
+    DUCKDB_GLOBAL(PlanCacheSizeSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
     DUCKDB_GLOBAL(PreserveInsertionOrder),
     DUCKDB_LOCAL(ProfileOutputSetting),
@@ -123,6 +127,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_LOCAL(QueryPrioritySetting),
+    DUCKDB_LOCAL(ReoptimizationThresholdSetting),
+    DUCKDB_GLOBAL(ResultCacheSizeSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
@@ -132,12 +139,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL(ArrowOutputListView),
+    DUCKDB_GLOBAL(ArrowStreamingResults),
     DUCKDB_GLOBAL(ProduceArrowStringView),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(FlushAllocatorSetting),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
+    DUCKDB_GLOBAL(SchedulerWorkStealingSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
@@ -7,6 +7,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -75,6 +76,8 @@ void DatabaseManager::DetachDatabase(ClientContext &context, const string &name,
 			throw BinderException("Failed to detach database with name \"%s\": database not found", name);
 		}
 	}
+	// cached results keep the tables they were computed from alive
+	ResultCache::Get(context).Clear();
 }
 
 optional_ptr<AttachedDatabase> DatabaseManager::GetDatabaseFromPath(ClientContext &context, const string &path) {
@@ -0,0 +1,597 @@
+#include "duckdb/main/materialized_view.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/parser/expression/list.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/list.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+//! How a column of a materialized view is maintained
+enum class MaterializedViewColumn : uint8_t { KEY, SUM, COUNT, MIN, MAX };
+
+struct MaterializedViewDefinition {
+	//! The query of the view
+	unique_ptr<SelectStatement> statement;
+	//! Whether or not the view can be maintained incrementally
+	bool incremental = false;
+	//! Whether or not the query is an aggregate (otherwise it is a select-project-join query)
+	bool aggregate = false;
+	//! How each column of the view is maintained (for aggregates)
+	vector<MaterializedViewColumn> columns;
+	//! The base table of each table reference in the query, in the order of CollectTableRefs
+	vector<reference<TableCatalogEntry>> tables;
+};
+
+static string GetStateKey(const string &catalog, const string &schema, const string &name) {
+	return "materialized_view:" + catalog + "." + schema + "." + name;
+}
+
+static string GetQualifiedName(const string &catalog, const string &schema, const string &name) {
+	return KeywordHelper::WriteOptionallyQuoted(catalog) + "." + KeywordHelper::WriteOptionallyQuoted(schema) + "." +
+	       KeywordHelper::WriteOptionallyQuoted(name);
+}
+
+//! Collects the base tables of a FROM clause that only consists of base tables and inner joins
+static bool CollectTableRefs(unique_ptr<TableRef> &ref, vector<reference<unique_ptr<TableRef>>> &result) {
+	if (ref->sample) {
+		return false;
+	}
+	switch (ref->type) {
+	case TableReferenceType::BASE_TABLE:
+		result.push_back(ref);
+		return true;
+	case TableReferenceType::JOIN: {
+		auto &join = ref->Cast<JoinRef>();
+		if (join.type != JoinType::INNER) {
+			return false;
+		}
+		switch (join.ref_type) {
+		case JoinRefType::REGULAR:
+		case JoinRefType::NATURAL:
+		case JoinRefType::CROSS:
+			break;
+		default:
+			return false;
+		}
+		return CollectTableRefs(join.left, result) && CollectTableRefs(join.right, result);
+	}
+	default:
+		return false;
+	}
+}
+
+//! Checks whether or not an expression can be evaluated on the changed rows of a query only
+static void CheckExpression(ClientContext &context, const ParsedExpression &expr, bool &supported,
+                            bool &has_aggregate) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::SUBQUERY:
+	case ExpressionClass::WINDOW:
+		supported = false;
+		return;
+	case ExpressionClass::FUNCTION: {
+		auto &function = expr.Cast<FunctionExpression>();
+		auto entry = Catalog::GetEntry(context, CatalogType::AGGREGATE_FUNCTION_ENTRY, function.catalog,
+		                               function.schema, function.function_name, OnEntryNotFound::RETURN_NULL);
+		if (entry && entry->type == CatalogType::AGGREGATE_FUNCTION_ENTRY) {
+			has_aggregate = true;
+		} else if (entry && entry->type == CatalogType::MACRO_ENTRY) {
+			// macros can hide aggregates and subqueries
+			supported = false;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](const ParsedExpression &child) { CheckExpression(context, child, supported, has_aggregate); });
+}
+
+//! Returns whether or not a select list entry is an aggregate that can be merged with the aggregate of other rows
+static bool GetAggregateColumn(ClientContext &context, const ParsedExpression &expr, MaterializedViewColumn &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::FUNCTION) {
+		return false;
+	}
+	auto &function = expr.Cast<FunctionExpression>();
+	if (!function.catalog.empty() || !function.schema.empty() || function.distinct || function.export_state) {
+		return false;
+	}
+	auto name = StringUtil::Lower(function.function_name);
+	if (name == "sum") {
+		result = MaterializedViewColumn::SUM;
+	} else if (name == "count" || name == "count_star") {
+		result = MaterializedViewColumn::COUNT;
+	} else if (name == "min") {
+		result = MaterializedViewColumn::MIN;
+	} else if (name == "max") {
+		result = MaterializedViewColumn::MAX;
+	} else {
+		return false;
+	}
+	bool supported = true;
+	bool has_aggregate = false;
+	for (auto &child : function.children) {
+		CheckExpression(context, *child, supported, has_aggregate);
+	}
+	if (function.filter) {
+		CheckExpression(context, *function.filter, supported, has_aggregate);
+	}
+	return supported && !has_aggregate;
+}
+
+//! Returns the select list entry a group refers to
+static optional_idx FindGroupColumn(const SelectNode &select, const ParsedExpression &group) {
+	if (group.GetExpressionClass() == ExpressionClass::CONSTANT) {
+		auto &value = group.Cast<ConstantExpression>().value;
+		if (!value.type().IsIntegral()) {
+			return optional_idx();
+		}
+		auto index = value.GetValue<int64_t>();
+		if (index < 1 || index > NumericCast<int64_t>(select.select_list.size())) {
+			return optional_idx();
+		}
+		return NumericCast<idx_t>(index - 1);
+	}
+	for (idx_t i = 0; i < select.select_list.size(); i++) {
+		if (select.select_list[i]->Equals(group)) {
+			return i;
+		}
+	}
+	if (group.GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+		auto &colref = group.Cast<ColumnRefExpression>();
+		if (!colref.IsQualified()) {
+			for (idx_t i = 0; i < select.select_list.size(); i++) {
+				if (StringUtil::CIEquals(select.select_list[i]->alias, colref.GetColumnName())) {
+					return i;
+				}
+			}
+		}
+	}
+	return optional_idx();
+}
+
+static bool IsIncremental(ClientContext &context, MaterializedViewDefinition &definition) {
+	auto &node = *definition.statement->node;
+	if (node.type != QueryNodeType::SELECT_NODE || !node.cte_map.map.empty()) {
+		return false;
+	}
+	auto &select = node.Cast<SelectNode>();
+	if (select.having || select.qualify || select.sample || select.groups.grouping_sets.size() > 1) {
+		return false;
+	}
+	for (auto &modifier : select.modifiers) {
+		if (modifier->type != ResultModifierType::ORDER_MODIFIER) {
+			return false;
+		}
+	}
+	// the query must read from base tables, combined with inner joins
+	vector<reference<unique_ptr<TableRef>>> refs;
+	if (!select.from_table || !CollectTableRefs(select.from_table, refs)) {
+		return false;
+	}
+	for (auto &ref : refs) {
+		auto &base = ref.get()->Cast<BaseTableRef>();
+		auto entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, base.catalog_name, base.schema_name,
+		                               base.table_name, OnEntryNotFound::RETURN_NULL);
+		if (!entry || entry->type != CatalogType::TABLE_ENTRY) {
+			return false;
+		}
+		auto &table = entry->Cast<TableCatalogEntry>();
+		if (!table.IsDuckTable()) {
+			return false;
+		}
+		definition.tables.push_back(table);
+	}
+	bool supported = true;
+	bool has_aggregate = false;
+	if (select.where_clause) {
+		CheckExpression(context, *select.where_clause, supported, has_aggregate);
+	}
+	for (auto &group : select.groups.group_expressions) {
+		CheckExpression(context, *group, supported, has_aggregate);
+	}
+	if (!supported || has_aggregate) {
+		return false;
+	}
+	// classify the select list
+	bool has_aggregate_column = false;
+	for (auto &expr : select.select_list) {
+		MaterializedViewColumn column;
+		if (GetAggregateColumn(context, *expr, column)) {
+			definition.columns.push_back(column);
+			has_aggregate_column = true;
+			continue;
+		}
+		CheckExpression(context, *expr, supported, has_aggregate);
+		if (!supported || has_aggregate) {
+			// aggregates that cannot be merged, or that are used within an expression
+			return false;
+		}
+		definition.columns.push_back(MaterializedViewColumn::KEY);
+	}
+	definition.aggregate = has_aggregate_column || !select.groups.group_expressions.empty() ||
+	                       select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES;
+	if (!definition.aggregate) {
+		return true;
+	}
+	for (auto &expr : select.select_list) {
+		if (expr->GetExpressionClass() == ExpressionClass::STAR) {
+			return false;
+		}
+	}
+	if (select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES) {
+		return true;
+	}
+	// every group must be in the select list, and every key column must be a group
+	vector<bool> grouped(select.select_list.size(), false);
+	for (auto &group : select.groups.group_expressions) {
+		auto index = FindGroupColumn(select, *group);
+		if (!index.IsValid() || definition.columns[index.GetIndex()] != MaterializedViewColumn::KEY) {
+			return false;
+		}
+		grouped[index.GetIndex()] = true;
+	}
+	for (idx_t i = 0; i < definition.columns.size(); i++) {
+		if (definition.columns[i] == MaterializedViewColumn::KEY && !grouped[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static MaterializedViewDefinition GetDefinition(ClientContext &context, const string &query) {
+	Parser parser(context.GetParserOptions());
+	parser.ParseQuery(query);
+	if (parser.statements.size() != 1 || parser.statements[0]->type != StatementType::SELECT_STATEMENT) {
+		throw ParserException("The query of a materialized view must be a single SELECT statement");
+	}
+	MaterializedViewDefinition result;
+	result.statement = unique_ptr_cast<SQLStatement, SelectStatement>(std::move(parser.statements[0]));
+	result.incremental = IsIncremental(context, result);
+	return result;
+}
+
+//! Creates a subquery that scans the rows of a table with a row id in [start, end)
+static unique_ptr<TableRef> CreateRangeScan(TableCatalogEntry &table, const BaseTableRef &ref, idx_t start,
+                                            idx_t end) {
+	auto scan = make_uniq<BaseTableRef>();
+	scan->catalog_name = table.ParentCatalog().GetName();
+	scan->schema_name = table.ParentSchema().name;
+	scan->table_name = table.name;
+
+	unique_ptr<ParsedExpression> filter = make_uniq<ComparisonExpression>(
+	    ExpressionType::COMPARE_LESSTHAN, make_uniq<ColumnRefExpression>("rowid"),
+	    make_uniq<ConstantExpression>(Value::BIGINT(NumericCast<int64_t>(end))));
+	if (start > 0) {
+		auto lower = make_uniq<ComparisonExpression>(
+		    ExpressionType::COMPARE_GREATERTHANOREQUALTO, make_uniq<ColumnRefExpression>("rowid"),
+		    make_uniq<ConstantExpression>(Value::BIGINT(NumericCast<int64_t>(start))));
+		filter = make_uniq<ConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(lower), std::move(filter));
+	}
+	auto node = make_uniq<SelectNode>();
+	node->select_list.push_back(make_uniq<StarExpression>());
+	node->from_table = std::move(scan);
+	node->where_clause = std::move(filter);
+	auto statement = make_uniq<SelectStatement>();
+	statement->node = std::move(node);
+
+	auto result = make_uniq<SubqueryRef>(std::move(statement), ref.alias.empty() ? ref.table_name : ref.alias);
+	result->column_name_alias = ref.column_name_alias;
+	return std::move(result);
+}
+
+//! Returns the query of the view, restricted to the given row id range of each of its table references
+static string GetRangeQuery(const MaterializedViewDefinition &definition, const vector<pair<idx_t, idx_t>> &ranges) {
+	auto node = definition.statement->node->Copy();
+	auto &select = node->Cast<SelectNode>();
+	select.modifiers.clear();
+	vector<reference<unique_ptr<TableRef>>> refs;
+	CollectTableRefs(select.from_table, refs);
+	D_ASSERT(refs.size() == ranges.size());
+	for (idx_t i = 0; i < refs.size(); i++) {
+		auto &ref = refs[i].get();
+		auto scan = CreateRangeScan(definition.tables[i], ref->Cast<BaseTableRef>(), ranges[i].first,
+		                            ranges[i].second);
+		ref = std::move(scan);
+	}
+	return select.ToString();
+}
+
+//! Returns the statements that merge the changes to the base tables into an aggregate view
+static string GetMergeStatements(const MaterializedViewDefinition &definition, const string &target,
+                                 const vector<string> &names, const string &delta_query) {
+	const string delta_table = "__duckdb_materialized_view_delta";
+	string aggregates;
+	string groups;
+	string updates;
+	string keys;
+	for (idx_t i = 0; i < names.size(); i++) {
+		auto name = KeywordHelper::WriteOptionallyQuoted(names[i]);
+		auto view_column = "__view." + name;
+		auto delta_column = "__delta." + name;
+		if (i > 0) {
+			aggregates += ", ";
+		}
+		string merge;
+		switch (definition.columns[i]) {
+		case MaterializedViewColumn::KEY:
+			aggregates += name;
+			groups += groups.empty() ? name : ", " + name;
+			keys += keys.empty() ? "" : " AND ";
+			keys += view_column + " IS NOT DISTINCT FROM " + delta_column;
+			continue;
+		case MaterializedViewColumn::SUM:
+			aggregates += "sum(" + name + ") AS " + name;
+			merge = view_column + " + " + delta_column;
+			break;
+		case MaterializedViewColumn::COUNT:
+			// counts are never NULL
+			aggregates += "sum(" + name + ") AS " + name;
+			updates += updates.empty() ? "" : ", ";
+			updates += name + " = " + view_column + " + " + delta_column;
+			continue;
+		case MaterializedViewColumn::MIN:
+			aggregates += "min(" + name + ") AS " + name;
+			merge = "least(" + view_column + ", " + delta_column + ")";
+			break;
+		case MaterializedViewColumn::MAX:
+			aggregates += "max(" + name + ") AS " + name;
+			merge = "greatest(" + view_column + ", " + delta_column + ")";
+			break;
+		}
+		// the aggregate of a group without any non-NULL values is NULL
+		updates += updates.empty() ? "" : ", ";
+		updates += StringUtil::Format("%s = CASE WHEN %s IS NULL THEN %s WHEN %s IS NULL THEN %s ELSE %s END", name,
+		                              delta_column, view_column, view_column, delta_column, merge);
+	}
+	string column_list;
+	for (auto &name : names) {
+		column_list += column_list.empty() ? "" : ", ";
+		column_list += KeywordHelper::WriteOptionallyQuoted(name);
+	}
+
+	string result;
+	result += StringUtil::Format("CREATE OR REPLACE TEMPORARY TABLE %s AS SELECT %s FROM (%s) AS __delta(%s)%s;\n",
+	                             delta_table, aggregates, delta_query, column_list,
+	                             groups.empty() ? "" : " GROUP BY " + groups);
+	if (!updates.empty()) {
+		result += StringUtil::Format("UPDATE %s AS __view SET %s FROM %s AS __delta%s;\n", target, updates,
+		                             delta_table, keys.empty() ? "" : " WHERE " + keys);
+	}
+	if (!keys.empty()) {
+		result += StringUtil::Format(
+		    "INSERT INTO %s SELECT * FROM %s AS __delta WHERE NOT EXISTS (SELECT 1 FROM %s AS __view WHERE %s);\n",
+		    target, delta_table, target, keys);
+	}
+	result += StringUtil::Format("DROP TABLE %s;\n", delta_table);
+	return result;
+}
+
+static string GetRefreshStatements(ClientContext &context, const string &catalog, const string &schema,
+                                   const string &name, const string &query, optional_ptr<TableCatalogEntry> view) {
+	auto definition = GetDefinition(context, query);
+	auto target = GetQualifiedName(catalog, schema, name);
+	// inside a transaction, the refresh has to see the changes made by the transaction itself - these are not
+	// tracked by the view, so we recompute the view and forget its state
+	bool autocommit = context.transaction.IsAutoCommit();
+	bool incremental = definition.incremental && autocommit;
+	vector<string> names;
+	if (view) {
+		for (auto &column : view->GetColumns().Logical()) {
+			names.push_back(column.Name());
+		}
+		// the maintenance statements refer to the columns of the view by name
+		unordered_set<string> unique_names;
+		for (auto &column_name : names) {
+			if (!unique_names.insert(StringUtil::Lower(column_name)).second) {
+				incremental = false;
+			}
+		}
+		if (definition.aggregate && definition.columns.size() != names.size()) {
+			incremental = false;
+		}
+	}
+
+	// the rows of the base tables that the refreshed view reflects
+	vector<MaterializedViewSource> sources;
+	for (auto &table_ref : definition.tables) {
+		auto &storage = table_ref.get().GetStorage();
+		MaterializedViewSource source;
+		source.table = storage.GetDataTableInfo();
+		source.row_count = storage.GetTotalRows();
+		source.row_change_count = storage.GetDataTableInfo()->GetRowChangeCount();
+		sources.push_back(std::move(source));
+	}
+
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto state = cache.GetOrCreate<MaterializedViewState>(GetStateKey(catalog, schema, name));
+	if (!state) {
+		throw InternalException("Object cache entry for materialized view \"%s\" has an unexpected type", name);
+	}
+	lock_guard<mutex> guard(state->lock);
+	// only apply the changes if the view has not been changed since it was last refreshed, and if no rows were
+	// deleted or updated in its base tables (in which case we cannot tell which rows of the view are affected)
+	bool apply_changes = incremental && view && state->valid && !state->refresh_pending &&
+	                     state->view.lock() == view->GetStorage().GetDataTableInfo() &&
+	                     state->view_commit_id == view->GetStorage().GetDataTableInfo()->GetLastCommitId() &&
+	                     state->sources.size() == sources.size();
+	for (idx_t i = 0; apply_changes && i < sources.size(); i++) {
+		auto &previous = state->sources[i];
+		auto &current = sources[i];
+		if (previous.table.lock() != current.table.lock() || previous.row_change_count != current.row_change_count ||
+		    previous.row_count > current.row_count) {
+			apply_changes = false;
+		}
+	}
+	state->refresh_id++;
+	state->refresh_pending = incremental;
+	if (!autocommit) {
+		state->valid = false;
+	}
+
+	string result;
+	if (!view) {
+		result += StringUtil::Format(
+		    "PRAGMA __internal_create_materialized_view(%s, %s, %s, %s);\n", KeywordHelper::WriteQuoted(catalog),
+		    KeywordHelper::WriteQuoted(schema), KeywordHelper::WriteQuoted(name), KeywordHelper::WriteQuoted(query));
+	}
+	if (apply_changes) {
+		// the changes of a join are the sum of joining the new rows of every table with the old rows of the tables
+		// after it and with all rows of the tables before it
+		vector<string> delta_queries;
+		for (idx_t i = 0; i < sources.size(); i++) {
+			if (sources[i].row_count == state->sources[i].row_count) {
+				continue;
+			}
+			vector<pair<idx_t, idx_t>> ranges;
+			for (idx_t j = 0; j < sources.size(); j++) {
+				if (j < i) {
+					ranges.emplace_back(0, sources[j].row_count);
+				} else if (j == i) {
+					ranges.emplace_back(state->sources[j].row_count, sources[j].row_count);
+				} else {
+					ranges.emplace_back(0, state->sources[j].row_count);
+				}
+			}
+			delta_queries.push_back(GetRangeQuery(definition, ranges));
+		}
+		if (!delta_queries.empty()) {
+			auto delta_query = StringUtil::Join(delta_queries, " UNION ALL ");
+			if (definition.aggregate) {
+				result += GetMergeStatements(definition, target, names, delta_query);
+			} else {
+				result += StringUtil::Format("INSERT INTO %s %s;\n", target, delta_query);
+			}
+		}
+	} else {
+		if (view) {
+			result += StringUtil::Format("DELETE FROM %s;\n", target);
+		}
+		if (incremental) {
+			vector<pair<idx_t, idx_t>> ranges;
+			for (auto &source : sources) {
+				ranges.emplace_back(0, source.row_count);
+			}
+			result += StringUtil::Format("INSERT INTO %s %s;\n", target, GetRangeQuery(definition, ranges));
+		} else {
+			result += StringUtil::Format("INSERT INTO %s %s;\n", target, query);
+		}
+	}
+	if (!autocommit) {
+		// the statements run in the transaction of the client
+		return result;
+	}
+	if (incremental) {
+		state->pending_sources = std::move(sources);
+	}
+	// outside of a transaction the statements run as a single statement in their own transaction, so a failing
+	// statement does not leave the client in an aborted transaction or the view half refreshed
+	return StringUtil::Format("PRAGMA __internal_refresh_materialized_view(%s, %s, %s, %llu, %s);\n",
+	                          KeywordHelper::WriteQuoted(catalog), KeywordHelper::WriteQuoted(schema),
+	                          KeywordHelper::WriteQuoted(name), state->refresh_id, KeywordHelper::WriteQuoted(result));
+}
+
+string MaterializedView::CreateQuery(ClientContext &context, const string &name, const string &query) {
+	auto qname = QualifiedName::Parse(name);
+	CreateTableInfo info(qname.catalog, qname.schema, qname.name);
+	auto binder = Binder::CreateBinder(context);
+	auto &schema = binder->BindSchema(info);
+	if (schema.catalog.IsSystemCatalog()) {
+		throw BinderException("Cannot create entry in system catalog");
+	}
+	auto catalog_name = schema.ParentCatalog().GetName();
+	if (Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, catalog_name, schema.name, qname.name,
+	                      OnEntryNotFound::RETURN_NULL)) {
+		throw CatalogException("Table with name \"%s\" already exists!", qname.name);
+	}
+	return GetRefreshStatements(context, catalog_name, schema.name, qname.name, query, nullptr);
+}
+
+string MaterializedView::RefreshQuery(ClientContext &context, const string &name) {
+	auto qname = QualifiedName::Parse(name);
+	auto &view = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	auto entry = view.tags.find(QUERY_TAG);
+	if (entry == view.tags.end()) {
+		throw CatalogException("\"%s\" is not a materialized view", name);
+	}
+	if (!view.IsDuckTable()) {
+		throw NotImplementedException("Materialized views are only supported in DuckDB databases");
+	}
+	return GetRefreshStatements(context, view.ParentCatalog().GetName(), view.ParentSchema().name, view.name,
+	                            entry->second, view);
+}
+
+void MaterializedView::CreateTable(ClientContext &context, const string &catalog, const string &schema,
+                                   const string &name, const string &query) {
+	auto definition = GetDefinition(context, query);
+	auto info = make_uniq<CreateTableInfo>(catalog, schema, name);
+	info->query = std::move(definition.statement);
+	info->tags[QUERY_TAG] = query;
+
+	auto &target = Catalog::GetCatalog(context, catalog);
+	MetaTransaction::Get(context).ModifyDatabase(target.GetAttached());
+	target.CreateTable(context, std::move(info));
+}
+
+//! Called when the refresh "refresh_id" of a materialized view has committed
+static void FinishRefresh(ClientContext &context, const string &catalog, const string &schema, const string &name,
+                          idx_t refresh_id) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto state = cache.Get<MaterializedViewState>(GetStateKey(catalog, schema, name));
+	if (!state) {
+		return;
+	}
+	auto &view = Catalog::GetEntry<TableCatalogEntry>(context, catalog, schema, name);
+	lock_guard<mutex> guard(state->lock);
+	if (!state->refresh_pending || state->refresh_id != refresh_id) {
+		// another refresh was started in the meantime - we do not know which of the two the view reflects
+		state->valid = false;
+		return;
+	}
+	state->refresh_pending = false;
+	state->view = view.GetStorage().GetDataTableInfo();
+	state->view_commit_id = view.GetStorage().GetDataTableInfo()->GetLastCommitId();
+	state->sources = std::move(state->pending_sources);
+	state->valid = true;
+}
+
+void MaterializedView::Refresh(ClientContext &context, const string &catalog, const string &schema,
+                               const string &name, idx_t refresh_id, const string &statements) {
+	// the refresh runs on a connection of its own: if any of its statements fails, the whole refresh is rolled back
+	// while the transaction of the client is not affected
+	Connection con(*context.db);
+	con.BeginTransaction();
+	auto &search_path = ClientData::Get(context).catalog_search_path->GetSetPaths();
+	if (!search_path.empty()) {
+		ClientData::Get(*con.context).catalog_search_path->Set(search_path, CatalogSetPathType::SET_SCHEMAS);
+	}
+	auto extracted = con.ExtractStatements(statements);
+	for (auto &statement : extracted) {
+		auto result = con.Query(std::move(statement));
+		if (result->HasError()) {
+			con.Rollback();
+			result->ThrowError();
+		}
+	}
+	con.Commit();
+	con.context->RunFunctionInTransaction([&]() { FinishRefresh(*con.context, catalog, schema, name, refresh_id); });
+}
+
+} // namespace duckdb
@@ -0,0 +1,248 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/between_expression.hpp"
+#include "duckdb/parser/expression/comparison_expression.hpp"
+#include "duckdb/parser/expression/conjunction_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/operator_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache() : entry_count(0), clock(0) {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetPlanCache();
+}
+
+static bool IsParameterizableConstant(const ParsedExpression &expr) {
+	if (expr.type != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &value = expr.Cast<ConstantExpression>().value;
+	if (value.IsNull()) {
+		return false;
+	}
+	// numeric constants are compared as numbers, string constants are cast to the type of the column
+	return value.type().IsNumeric() || value.type().id() == LogicalTypeId::VARCHAR;
+}
+
+static void ReplaceConstant(unique_ptr<ParsedExpression> &expr, vector<Value> &values) {
+	if (!IsParameterizableConstant(*expr)) {
+		return;
+	}
+	values.push_back(expr->Cast<ConstantExpression>().value);
+	auto parameter = make_uniq<ParameterExpression>();
+	parameter->identifier = to_string(values.size());
+	parameter->alias = expr->alias;
+	expr = std::move(parameter);
+}
+
+static void ParameterizeFilter(unique_ptr<ParsedExpression> &expr, vector<Value> &values) {
+	switch (expr->GetExpressionClass()) {
+	case ExpressionClass::COMPARISON: {
+		// the type of the parameter is derived from the column it is compared with
+		auto &comparison = expr->Cast<ComparisonExpression>();
+		if (comparison.left->type == ExpressionType::COLUMN_REF) {
+			ReplaceConstant(comparison.right, values);
+		} else if (comparison.right->type == ExpressionType::COLUMN_REF) {
+			ReplaceConstant(comparison.left, values);
+		}
+		break;
+	}
+	case ExpressionClass::BETWEEN: {
+		auto &between = expr->Cast<BetweenExpression>();
+		if (between.input->type == ExpressionType::COLUMN_REF) {
+			ReplaceConstant(between.lower, values);
+			ReplaceConstant(between.upper, values);
+		}
+		break;
+	}
+	case ExpressionClass::OPERATOR: {
+		auto &op = expr->Cast<OperatorExpression>();
+		if (op.type == ExpressionType::COMPARE_IN || op.type == ExpressionType::COMPARE_NOT_IN) {
+			if (op.children[0]->type == ExpressionType::COLUMN_REF) {
+				for (idx_t i = 1; i < op.children.size(); i++) {
+					ReplaceConstant(op.children[i], values);
+				}
+			}
+		} else if (op.type == ExpressionType::OPERATOR_NOT) {
+			ParameterizeFilter(op.children[0], values);
+		}
+		break;
+	}
+	case ExpressionClass::CONJUNCTION: {
+		auto &conjunction = expr->Cast<ConjunctionExpression>();
+		for (auto &child : conjunction.children) {
+			ParameterizeFilter(child, values);
+		}
+		break;
+	}
+	default:
+		// constants in other places (e.g. function arguments) often have to be known when binding
+		break;
+	}
+}
+
+static void ParameterizeQueryNode(QueryNode &node, vector<Value> &values) {
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select = node.Cast<SelectNode>();
+		if (select.where_clause) {
+			ParameterizeFilter(select.where_clause, values);
+		}
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &set_operation = node.Cast<SetOperationNode>();
+		ParameterizeQueryNode(*set_operation.left, values);
+		ParameterizeQueryNode(*set_operation.right, values);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+unique_ptr<SQLStatement> PlanCache::Parameterize(const SQLStatement &statement, vector<Value> &values) {
+	D_ASSERT(statement.type == StatementType::SELECT_STATEMENT);
+	auto result = statement.Copy();
+	ParameterizeQueryNode(*result->Cast<SelectStatement>().node, values);
+	result->n_param = values.size();
+	for (idx_t i = 0; i < values.size(); i++) {
+		result->named_param_map[to_string(i + 1)] = i + 1;
+	}
+	return result;
+}
+
+bool PlanCache::BindParameters(ClientContext &context, PreparedStatementData &prepared, const vector<Value> &values,
+                               case_insensitive_map_t<BoundParameterData> &result) {
+	if (prepared.value_map.size() != values.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < values.size(); i++) {
+		auto identifier = to_string(i + 1);
+		auto entry = prepared.value_map.find(identifier);
+		if (entry == prepared.value_map.end()) {
+			return false;
+		}
+		auto &value = values[i];
+		auto &parameter_type = entry->second->return_type;
+		Value parameter_value;
+		if (!value.DefaultTryCastAs(parameter_type, parameter_value, nullptr, true)) {
+			return false;
+		}
+		if (value.type().IsNumeric()) {
+			// the constant would have been compared as a number - only use it if the conversion is lossless
+			Value original_value;
+			if (!parameter_type.IsNumeric() ||
+			    !parameter_value.DefaultTryCastAs(value.type(), original_value, nullptr, true) ||
+			    original_value != value) {
+				return false;
+			}
+		}
+		result.emplace(identifier, BoundParameterData(std::move(parameter_value)));
+	}
+	return true;
+}
+
+shared_ptr<PlanCacheEntry> PlanCache::Lookup(ClientContext &context, const string &query) {
+	lock_guard<mutex> guard(lock);
+	auto connection = connections.find(context);
+	if (connection == connections.end()) {
+		return nullptr;
+	}
+	auto entry = connection->second.find(query);
+	if (entry == connection->second.end()) {
+		return nullptr;
+	}
+	entry->second->hits++;
+	entry->second->last_used = ++clock;
+	return entry->second;
+}
+
+void PlanCache::Insert(ClientContext &context, const string &query, shared_ptr<PlanCacheEntry> entry) {
+	auto capacity = DBConfig::GetConfig(context).options.plan_cache_size;
+	lock_guard<mutex> guard(lock);
+	auto &entries = connections[context];
+	auto existing = entries.find(query);
+	if (existing != entries.end()) {
+		entries.erase(existing);
+		entry_count--;
+	}
+	while (entry_count > 0 && entry_count >= capacity) {
+		// evict the least recently used entry
+		optional_ptr<unordered_map<string, shared_ptr<PlanCacheEntry>>> victim_entries;
+		string victim_query;
+		idx_t victim_last_used = NumericLimits<idx_t>::Maximum();
+		for (auto &connection : connections) {
+			for (auto &kv : connection.second) {
+				if (kv.second->last_used < victim_last_used) {
+					victim_entries = connection.second;
+					victim_query = kv.first;
+					victim_last_used = kv.second->last_used;
+				}
+			}
+		}
+		victim_entries->erase(victim_query);
+		entry_count--;
+	}
+	if (capacity == 0) {
+		return;
+	}
+	entry->last_used = ++clock;
+	entries[query] = std::move(entry);
+	entry_count++;
+}
+
+void PlanCache::Erase(ClientContext &context, const string &query) {
+	lock_guard<mutex> guard(lock);
+	auto connection = connections.find(context);
+	if (connection == connections.end()) {
+		return;
+	}
+	entry_count -= connection->second.erase(query);
+}
+
+void PlanCache::RemoveConnection(ClientContext &context) {
+	lock_guard<mutex> guard(lock);
+	auto connection = connections.find(context);
+	if (connection == connections.end()) {
+		return;
+	}
+	entry_count -= connection->second.size();
+	connections.erase(connection);
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	connections.clear();
+	entry_count = 0;
+}
+
+vector<PlanCacheInfo> PlanCache::GetEntries() {
+	vector<PlanCacheInfo> result;
+	lock_guard<mutex> guard(lock);
+	for (auto &connection : connections) {
+		for (auto &kv : connection.second) {
+			auto &entry = *kv.second;
+			PlanCacheInfo info;
+			info.query = kv.first;
+			info.cacheable = entry.prepared != nullptr;
+			info.parameter_count = entry.prepared ? entry.prepared->properties.parameter_count : 0;
+			info.hits = entry.hits;
+			result.push_back(std::move(info));
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -367,6 +367,21 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	profiler.timings.clear();
 }
 
+void QueryProfiler::AddToExtraInfo(const PhysicalOperator &phys_op, const string &key, const string &value) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(phys_op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	auto &info = entry->second.get().GetProfilingInfo();
+	if (info.Enabled(MetricsType::EXTRA_INFO)) {
+		info.extra_info[key] = value;
+	}
+}
+
 string QueryProfiler::DrawPadded(const string &str, idx_t width) {
 	if (str.size() > width) {
 		return str.substr(0, width);
@@ -639,6 +654,8 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 	}
 	query_requires_profiling = false;
 	ClientConfig &config = ClientConfig::GetConfig(context);
+	// a query that is planned again during execution is profiled with its new plan
+	tree_map.clear();
 	root = CreateTree(root_op, config.profiler_settings, 0);
 	if (!query_requires_profiling) {
 		// query does not require profiling: disable profiling for this query
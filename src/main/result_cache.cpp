@@ -0,0 +1,225 @@
+#include "duckdb/main/result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+ResultCache::ResultCache() : memory_usage(0), clock(0) {
+}
+
+ResultCache &ResultCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetResultCache();
+}
+
+bool ResultCache::GetDependencies(LogicalOperator &plan, vector<shared_ptr<DataTableInfo>> &tables) {
+	switch (plan.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = plan.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			// table functions can return anything
+			return false;
+		}
+		if (table->temporary) {
+			// temporary tables are dropped together with their connection
+			return false;
+		}
+		tables.push_back(table->Cast<DuckTableEntry>().GetStorage().GetDataTableInfo());
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool consistent = true;
+	LogicalOperatorVisitor::EnumerateExpressions(plan, [&](unique_ptr<Expression> *expression) {
+		if (!(*expression)->IsConsistent()) {
+			consistent = false;
+		}
+	});
+	if (!consistent) {
+		return false;
+	}
+	for (auto &child : plan.children) {
+		if (!GetDependencies(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void AddVariables(string &key, const case_insensitive_map_t<Value> &variables) {
+	vector<string> entries;
+	for (auto &entry : variables) {
+		entries.push_back(entry.first + "=" + entry.second.ToSQLString());
+	}
+	std::sort(entries.begin(), entries.end());
+	for (auto &entry : entries) {
+		key += "\n" + entry;
+	}
+}
+
+string ResultCache::GetKey(ClientContext &context, const SQLStatement &statement) {
+	auto key = statement.ToString();
+	// the result of a query can depend on the settings of the connection (e.g. the search path)
+	for (idx_t i = 0; i < DBConfig::GetOptionCount(); i++) {
+		auto option = DBConfig::GetOptionByIndex(i);
+		if (!option->set_local) {
+			continue;
+		}
+		key += "\n" + string(option->name) + "=" + option->get_setting(context).ToString();
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	AddVariables(key, config.set_variables);
+	AddVariables(key, config.user_variables);
+	return key;
+}
+
+shared_ptr<ResultCacheEntry> ResultCache::CreateEntry(ClientContext &context, const string &query,
+                                                      PreparedStatementData &prepared) {
+	D_ASSERT(prepared.result_cacheable);
+	auto entry = make_shared_ptr<ResultCacheEntry>();
+	entry->query = query;
+	for (auto &table : prepared.result_tables) {
+		auto &transaction = DuckTransaction::Get(context, table->GetDB());
+		auto commit_id = table->GetLastCommitId();
+		if (commit_id >= transaction.start_time) {
+			// the table was changed by a transaction that committed after this transaction started
+			return nullptr;
+		}
+		entry->tables.push_back(ResultCacheTable {table, commit_id});
+	}
+	entry->read_databases = prepared.properties.read_databases;
+	entry->types = prepared.types;
+	return entry;
+}
+
+shared_ptr<PreparedStatementData> ResultCache::CreateScan(PreparedStatementData &prepared, ResultCacheEntry &entry) {
+	D_ASSERT(entry.collection);
+	auto result = make_shared_ptr<PreparedStatementData>(prepared.statement_type);
+	result->properties = prepared.properties;
+	result->names = prepared.names;
+	result->types = prepared.types;
+	result->plan = make_uniq<PhysicalColumnDataScan>(prepared.types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+	                                                 entry.collection->Count(), *entry.collection);
+	return result;
+}
+
+static bool ResultIsCurrent(const ResultCacheEntry &cached, const ResultCacheEntry &current) {
+	if (cached.types != current.types || cached.read_databases != current.read_databases) {
+		return false;
+	}
+	if (cached.tables.size() != current.tables.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < cached.tables.size(); i++) {
+		if (cached.tables[i].info != current.tables[i].info ||
+		    cached.tables[i].commit_id != current.tables[i].commit_id) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void ResultCache::EraseInternal(unordered_map<string, shared_ptr<ResultCacheEntry>>::iterator entry) {
+	memory_usage -= entry->second->size;
+	entries.erase(entry);
+}
+
+shared_ptr<ResultCacheEntry> ResultCache::Lookup(const string &key, const ResultCacheEntry &current) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	if (!ResultIsCurrent(*entry->second, current)) {
+		// the tables have changed - the result can never be used again
+		EraseInternal(entry);
+		return nullptr;
+	}
+	entry->second->hits++;
+	entry->second->last_used = ++clock;
+	return entry->second;
+}
+
+void ResultCache::Insert(ClientContext &context, const string &key, shared_ptr<ResultCacheEntry> entry,
+                         MaterializedQueryResult &result) {
+	if (entry->collection) {
+		// the result was read from the cache
+		return;
+	}
+	auto capacity = DBConfig::GetConfig(context).options.result_cache_size;
+	auto &source = result.Collection();
+	if (source.SizeInBytes() > capacity) {
+		return;
+	}
+	// copy the result into buffer-managed memory
+	auto collection = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), source.Types());
+	ColumnDataAppendState append_state;
+	collection->InitializeAppend(append_state);
+	for (auto &chunk : source.Chunks()) {
+		collection->Append(append_state, chunk);
+	}
+	auto size = collection->AllocationSize();
+	if (size > capacity) {
+		return;
+	}
+	entry->collection = std::move(collection);
+	entry->size = size;
+
+	lock_guard<mutex> guard(lock);
+	auto existing = entries.find(key);
+	if (existing != entries.end()) {
+		EraseInternal(existing);
+	}
+	while (!entries.empty() && memory_usage + size > capacity) {
+		// evict the least recently used result
+		auto victim = entries.begin();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			if (it->second->last_used < victim->second->last_used) {
+				victim = it;
+			}
+		}
+		EraseInternal(victim);
+	}
+	entry->last_used = ++clock;
+	memory_usage += size;
+	entries[key] = std::move(entry);
+}
+
+void ResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	memory_usage = 0;
+}
+
+vector<ResultCacheInfo> ResultCache::GetEntries() {
+	vector<ResultCacheInfo> result;
+	lock_guard<mutex> guard(lock);
+	for (auto &kv : entries) {
+		auto &entry = *kv.second;
+		ResultCacheInfo info;
+		info.query = entry.query;
+		info.row_count = entry.collection->Count();
+		info.memory_usage = entry.size;
+		info.hits = entry.hits;
+		result.push_back(std::move(info));
+	}
+	return result;
+}
+
+} // namespace duckdb
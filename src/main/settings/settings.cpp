@@ -8,7 +8,9 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -610,6 +612,38 @@ Value EnableObjectCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.object_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Query Admission
+//===--------------------------------------------------------------------===//
+void EnableQueryAdmissionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_query_admission = input.GetValue<bool>();
+}
+
+void EnableQueryAdmissionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_query_admission = DBConfig().options.enable_query_admission;
+}
+
+Value EnableQueryAdmissionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_query_admission);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Admission Timeout
+//===--------------------------------------------------------------------===//
+void QueryAdmissionTimeoutSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_admission_timeout = input.GetValue<uint64_t>();
+}
+
+void QueryAdmissionTimeoutSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_admission_timeout = DBConfig().options.query_admission_timeout;
+}
+
+Value QueryAdmissionTimeoutSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.query_admission_timeout);
+}
+
 //===--------------------------------------------------------------------===//
 // Storage Compatibility Version (for serialization)
 //===--------------------------------------------------------------------===//
@@ -1220,6 +1254,21 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Maximum Query Threads
+//===--------------------------------------------------------------------===//
+void MaximumQueryThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).max_query_threads = ClientConfig().max_query_threads;
+}
+
+void MaximumQueryThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).max_query_threads = input.GetValue<uint64_t>();
+}
+
+Value MaximumQueryThreadsSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).max_query_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Merge Join Threshold
 //===--------------------------------------------------------------------===//
@@ -1420,6 +1469,29 @@ Value PivotLimitSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).pivot_limit));
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<uint64_t>();
+	if (db) {
+		// entries are evicted when new plans are inserted - drop everything so the new size applies immediately
+		db->GetPlanCache().Clear();
+	}
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+	if (db) {
+		db->GetPlanCache().Clear();
+	}
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -1489,6 +1561,22 @@ Value ArrowOutputListView::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(arrow_output_list_view);
 }
 
+//===--------------------------------------------------------------------===//
+// ArrowStreamingResults
+//===--------------------------------------------------------------------===//
+void ArrowStreamingResults::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.arrow_streaming_results = input.GetValue<bool>();
+}
+
+void ArrowStreamingResults::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.arrow_streaming_results = DBConfig().options.arrow_streaming_results;
+}
+
+Value ArrowStreamingResults::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(DBConfig::GetConfig(context).options.arrow_streaming_results);
+}
+
+//===--------------------------------------------------------------------===//
 // ProduceArrowStringView
 //===--------------------------------------------------------------------===//
 void ProduceArrowStringView::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
@@ -1575,6 +1663,66 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	const auto param = input.GetValue<uint64_t>();
+	if (param == 0) {
+		throw InvalidInputException("Invalid option for query_priority, value must be positive");
+	}
+	ClientConfig::GetConfig(context).query_priority = param;
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_priority);
+}
+
+//===--------------------------------------------------------------------===//
+// Reoptimization Threshold
+//===--------------------------------------------------------------------===//
+void ReoptimizationThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).reoptimization_threshold = ClientConfig().reoptimization_threshold;
+}
+
+void ReoptimizationThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1) {
+		throw InvalidInputException("Invalid option for reoptimization_threshold, value must be 0 or at least 1");
+	}
+	ClientConfig::GetConfig(context).reoptimization_threshold = threshold;
+}
+
+Value ReoptimizationThresholdSetting::GetSetting(const ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).reoptimization_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Result Cache Size
+//===--------------------------------------------------------------------===//
+void ResultCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.result_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		db->GetResultCache().Clear();
+	}
+}
+
+void ResultCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.result_cache_size = DBConfig().options.result_cache_size;
+	if (db) {
+		db->GetResultCache().Clear();
+	}
+}
+
+Value ResultCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.result_cache_size));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1746,6 +1894,28 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Scheduler Work Stealing
+//===--------------------------------------------------------------------===//
+void SchedulerWorkStealingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scheduler_work_stealing = input.GetValue<bool>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetWorkStealing(config.options.scheduler_work_stealing);
+	}
+}
+
+void SchedulerWorkStealingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scheduler_work_stealing = DBConfig().options.scheduler_work_stealing;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetWorkStealing(config.options.scheduler_work_stealing);
+	}
+}
+
+Value SchedulerWorkStealingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.scheduler_work_stealing);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -4,6 +4,7 @@
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/buffered_data/arrow_buffered_data.hpp"
 
 namespace duckdb {
 
@@ -70,20 +71,30 @@ static bool ExecutionErrorOccurred(StreamExecutionResult result) {
 }
 
 unique_ptr<DataChunk> StreamQueryResult::FetchInternal(ClientContextLock &lock) {
-	bool invalidate_query = true;
 	unique_ptr<DataChunk> chunk;
+	FetchBufferedInternal(lock, [&]() {
+		chunk = buffered_data->Scan();
+		if (!chunk || chunk->ColumnCount() == 0 || chunk->size() == 0) {
+			chunk = nullptr;
+			return false;
+		}
+		return true;
+	});
+	return chunk;
+}
+
+void StreamQueryResult::FetchBufferedInternal(ClientContextLock &lock, const std::function<bool()> &scan) {
+	bool invalidate_query = true;
 	try {
-		// fetch the chunk and return it
+		// replenish the buffer and scan from it
 		auto stream_execution_result = buffered_data->ReplenishBuffer(*this, lock);
 		if (ExecutionErrorOccurred(stream_execution_result)) {
-			return chunk;
+			return;
 		}
-		chunk = buffered_data->Scan();
-		if (!chunk || chunk->ColumnCount() == 0 || chunk->size() == 0) {
+		if (!scan()) {
 			context->CleanupInternal(lock, this);
-			chunk = nullptr;
 		}
-		return chunk;
+		return;
 	} catch (std::exception &ex) {
 		ErrorData error(ex);
 		if (!Exception::InvalidatesTransaction(error.Type())) {
@@ -103,7 +114,6 @@ unique_ptr<DataChunk> StreamQueryResult::FetchInternal(ClientContextLock &lock)
 		SetError(ErrorData("Unhandled exception in FetchInternal"));
 	} // LCOV_EXCL_STOP
 	context->CleanupInternal(lock, this, invalidate_query);
-	return nullptr;
 }
 
 unique_ptr<DataChunk> StreamQueryResult::FetchRaw() {
@@ -120,6 +130,29 @@ unique_ptr<DataChunk> StreamQueryResult::FetchRaw() {
 	return chunk;
 }
 
+bool StreamQueryResult::ProducesArrowArrays() const {
+	return buffered_data && buffered_data->GetType() == ArrowBufferedData::TYPE;
+}
+
+unique_ptr<ArrowArrayWrapper> StreamQueryResult::FetchArrowArray() {
+	if (!ProducesArrowArrays()) {
+		throw InvalidInputException("FetchArrowArray can only be used on results that are streamed as Arrow arrays");
+	}
+	unique_ptr<ArrowArrayWrapper> array;
+	{
+		auto lock = LockContext();
+		CheckExecutableInternal(*lock);
+		FetchBufferedInternal(*lock, [&]() {
+			array = buffered_data->Cast<ArrowBufferedData>().ScanArrow();
+			return array != nullptr;
+		});
+	}
+	if (!array) {
+		Close();
+	}
+	return array;
+}
+
 #ifdef DUCKDB_ALTERNATIVE_VERIFY
 static unique_ptr<DataChunk> AlternativeFetch(StreamQueryResult &stream_result) {
 	// We first use StreamQueryResult::ExecuteTask until IsChunkReady becomes true
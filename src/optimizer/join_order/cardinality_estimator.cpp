@@ -395,6 +395,10 @@ idx_t CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set)
 	return (idx_t)cardinality_as_double;
 }
 
+void CardinalityEstimator::SetCardinality(JoinRelationSet &set, double cardinality) {
+	relation_set_2_cardinality[set.ToString()] = CardinalityHelper(cardinality);
+}
+
 bool SortTdoms(const RelationsToTDom &a, const RelationsToTDom &b) {
 	if (a.has_tdom_hll && b.has_tdom_hll) {
 		return a.tdom_hll > b.tdom_hll;
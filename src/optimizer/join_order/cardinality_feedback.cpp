@@ -0,0 +1,71 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback::CardinalityFeedback(double threshold)
+    : threshold(threshold), restart_requested(false), restarts(0) {
+}
+
+static void GetLeafTableIndexesRecursive(LogicalOperator &op, vector<idx_t> &result) {
+	if (op.children.empty()) {
+		for (auto &table_index : op.GetTableIndex()) {
+			result.push_back(table_index);
+		}
+		return;
+	}
+	for (auto &child : op.children) {
+		GetLeafTableIndexesRecursive(*child, result);
+	}
+}
+
+vector<idx_t> CardinalityFeedback::GetLeafTableIndexes(LogicalOperator &op) {
+	vector<idx_t> result;
+	GetLeafTableIndexesRecursive(op, result);
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+bool CardinalityFeedback::Observe(const vector<idx_t> &table_indexes, idx_t estimated_cardinality,
+                                  idx_t cardinality) {
+	if (table_indexes.empty()) {
+		return false;
+	}
+	auto estimate = static_cast<double>(MaxValue<idx_t>(estimated_cardinality, 1));
+	auto actual = static_cast<double>(MaxValue<idx_t>(cardinality, 1));
+	if (MaxValue(estimate / actual, actual / estimate) <= threshold) {
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	if (restarts >= MAX_RESTARTS) {
+		return false;
+	}
+	for (auto &entry : observed) {
+		if (entry.table_indexes == table_indexes) {
+			// the plan already used this cardinality - re-planning again would not help
+			return false;
+		}
+	}
+	observed.push_back(ObservedCardinality {table_indexes, cardinality});
+	restart_requested = true;
+	return true;
+}
+
+vector<ObservedCardinality> CardinalityFeedback::GetObservedCardinalities() {
+	lock_guard<mutex> guard(lock);
+	return observed;
+}
+
+bool CardinalityFeedback::RestartRequested() {
+	lock_guard<mutex> guard(lock);
+	return restart_requested;
+}
+
+void CardinalityFeedback::Restart() {
+	lock_guard<mutex> guard(lock);
+	restart_requested = false;
+	restarts++;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 
@@ -439,6 +440,8 @@ void PlanEnumerator::InitLeafPlans() {
 	// function ensures that a unique combination of relations will have a unique JoinRelationSet object.
 	// first initialize equivalent relations based on the filters
 	auto relation_stats = query_graph_manager.relation_manager.GetRelationStats();
+	vector<pair<reference<JoinRelationSet>, idx_t>> observed_sets;
+	ApplyCardinalityFeedback(relation_stats, observed_sets);
 
 	cost_model.cardinality_estimator.InitEquivalentRelations(query_graph_manager.GetFilterBindings());
 	cost_model.cardinality_estimator.AddRelationNamesToTdoms(relation_stats);
@@ -454,6 +457,60 @@ void PlanEnumerator::InitLeafPlans() {
 		plans[relation_set] = std::move(join_node);
 		cost_model.cardinality_estimator.InitCardinalityEstimatorProps(&relation_set, stats);
 	}
+	for (auto &entry : observed_sets) {
+		cost_model.cardinality_estimator.SetCardinality(entry.first, static_cast<double>(entry.second));
+	}
+}
+
+void PlanEnumerator::ApplyCardinalityFeedback(vector<RelationStats> &relation_stats,
+                                              vector<pair<reference<JoinRelationSet>, idx_t>> &observed_sets) {
+	auto feedback = query_graph_manager.context.GetCardinalityFeedback();
+	if (!feedback) {
+		return;
+	}
+	auto observed = feedback->GetObservedCardinalities();
+	if (observed.empty()) {
+		return;
+	}
+	// map the leaves of the relations to the relations, so we can find the relations of each observed sub-plan
+	auto &relation_manager = query_graph_manager.relation_manager;
+	unordered_map<idx_t, idx_t> leaf_relations;
+	vector<idx_t> relation_leaf_counts;
+	for (idx_t relation_id = 0; relation_id < relation_stats.size(); relation_id++) {
+		auto leaves = CardinalityFeedback::GetLeafTableIndexes(relation_manager.GetRelationOperator(relation_id));
+		for (auto &leaf : leaves) {
+			leaf_relations[leaf] = relation_id;
+		}
+		relation_leaf_counts.push_back(leaves.size());
+	}
+	for (auto &entry : observed) {
+		unordered_set<idx_t> relations;
+		bool found = true;
+		for (auto &leaf : entry.table_indexes) {
+			auto it = leaf_relations.find(leaf);
+			if (it == leaf_relations.end()) {
+				found = false;
+				break;
+			}
+			relations.insert(it->second);
+		}
+		if (!found) {
+			continue;
+		}
+		// the sub-plan has to consist of whole relations
+		idx_t leaf_count = 0;
+		for (auto &relation_id : relations) {
+			leaf_count += relation_leaf_counts[relation_id];
+		}
+		if (leaf_count != entry.table_indexes.size()) {
+			continue;
+		}
+		if (relations.size() == 1) {
+			relation_stats[*relations.begin()].cardinality = entry.cardinality;
+		} else {
+			observed_sets.emplace_back(query_graph_manager.set_manager.GetJoinRelation(relations), entry.cardinality);
+		}
+	}
 }
 
 // the plan enumeration is a straight implementation of the paper "Dynamic Programming Strikes Back" by Guido
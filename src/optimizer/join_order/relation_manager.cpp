@@ -24,6 +24,11 @@ vector<unique_ptr<SingleJoinRelation>> RelationManager::GetRelations() {
 	return std::move(relations);
 }
 
+LogicalOperator &RelationManager::GetRelationOperator(idx_t relation_id) {
+	D_ASSERT(relation_id < relations.size());
+	return relations[relation_id]->op;
+}
+
 idx_t RelationManager::NumRelations() {
 	return relations.size();
 }
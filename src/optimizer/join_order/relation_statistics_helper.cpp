@@ -1,4 +1,5 @@
 #include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/planner/expression/list.hpp"
 #include "duckdb/planner/operator/list.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -8,6 +9,10 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/column_histogram.hpp"
+#include "duckdb/storage/statistics/column_dependency.hpp"
+
+#include <cmath>
 
 namespace duckdb {
 
@@ -52,6 +57,159 @@ static ExpressionBinding GetChildColumnBinding(Expression &expr) {
 	return ret;
 }
 
+static void CollectConjunctionFilters(TableFilter &filter, vector<reference<TableFilter>> &result) {
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			CollectConjunctionFilters(*child_filter, result);
+		}
+		return;
+	}
+	result.push_back(filter);
+}
+
+bool RelationStatisticsHelper::TryEstimateSelectivity(TableFilter &filter, const ColumnHistogram &histogram,
+                                                      BaseStatistics &base_stats, FilterSelectivity &result) {
+	vector<reference<TableFilter>> filters;
+	CollectConjunctionFilters(filter, filters);
+
+	result.selectivity = 1;
+	result.is_equality = false;
+	optional_ptr<const Value> lower;
+	optional_ptr<const Value> upper;
+	bool lower_inclusive = false;
+	bool upper_inclusive = false;
+	auto distinct_count = base_stats.GetDistinctCount();
+	for (auto &entry : filters) {
+		auto &child_filter = entry.get();
+		switch (child_filter.filter_type) {
+		case TableFilterType::IS_NULL:
+			result.selectivity = MinValue(result.selectivity, histogram.null_fraction);
+			break;
+		case TableFilterType::IS_NOT_NULL:
+			result.selectivity = MinValue(result.selectivity, 1 - histogram.null_fraction);
+			break;
+		case TableFilterType::CONSTANT_COMPARISON: {
+			auto &comparison = child_filter.Cast<ConstantFilter>();
+			auto &constant = comparison.constant;
+			if (constant.type() != base_stats.GetType()) {
+				return false;
+			}
+			switch (comparison.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+				result.selectivity =
+				    MinValue(result.selectivity, histogram.EstimateEquality(constant, distinct_count));
+				result.is_equality = true;
+				break;
+			case ExpressionType::COMPARE_NOTEQUAL:
+				result.selectivity =
+				    MinValue(result.selectivity,
+				             1 - histogram.null_fraction - histogram.EstimateEquality(constant, distinct_count));
+				break;
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				if (!lower || constant > *lower) {
+					lower = &constant;
+					lower_inclusive = comparison.comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+				}
+				break;
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+				if (!upper || constant < *upper) {
+					upper = &constant;
+					upper_inclusive = comparison.comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+				}
+				break;
+			default:
+				return false;
+			}
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	if (lower || upper) {
+		double range_selectivity;
+		if (!histogram.TryEstimateRange(lower.get(), lower_inclusive, upper.get(), upper_inclusive,
+		                                range_selectivity)) {
+			return false;
+		}
+		result.selectivity = MinValue(result.selectivity, range_selectivity);
+	}
+	result.selectivity = MaxValue<double>(result.selectivity, 0);
+	return true;
+}
+
+double RelationStatisticsHelper::CombineSelectivities(vector<FilterSelectivity> &filters,
+                                                      vector<ColumnDependency> dependencies) {
+	// apply the strongest dependencies between columns with equality filters first:
+	// if "a" determines "b" with degree d, then P(a = x AND b = y) = P(a = x) * (d + (1 - d) * P(b = y))
+	std::sort(dependencies.begin(), dependencies.end(),
+	          [](const ColumnDependency &a, const ColumnDependency &b) { return a.degree > b.degree; });
+	vector<bool> is_determinant(filters.size(), false);
+	vector<bool> is_dependent(filters.size(), false);
+	for (auto &dependency : dependencies) {
+		optional_idx determinant;
+		optional_idx dependent;
+		for (idx_t i = 0; i < filters.size(); i++) {
+			if (!filters[i].is_equality) {
+				continue;
+			}
+			if (filters[i].storage_index == dependency.determinant) {
+				determinant = i;
+			} else if (filters[i].storage_index == dependency.dependent) {
+				dependent = i;
+			}
+		}
+		// a column is either used to determine other columns, or determined by another column
+		if (!determinant.IsValid() || !dependent.IsValid() || is_dependent[determinant.GetIndex()] ||
+		    is_dependent[dependent.GetIndex()] || is_determinant[dependent.GetIndex()]) {
+			continue;
+		}
+		auto &selectivity = filters[dependent.GetIndex()].selectivity;
+		selectivity = dependency.degree + (1 - dependency.degree) * selectivity;
+		is_determinant[determinant.GetIndex()] = true;
+		is_dependent[dependent.GetIndex()] = true;
+	}
+
+	// the remaining columns are not assumed to be fully independent: use an exponential backoff, in which the most
+	// selective filter counts fully, the next one with the square root of its selectivity, etc.
+	vector<double> selectivities;
+	for (auto &filter : filters) {
+		selectivities.push_back(filter.selectivity);
+	}
+	std::sort(selectivities.begin(), selectivities.end());
+	double result = 1;
+	double exponent = 1;
+	for (idx_t i = 0; i < selectivities.size() && i < MAX_BACKOFF_FILTERS; i++) {
+		result *= std::pow(selectivities[i], exponent);
+		exponent /= 2;
+	}
+	return result;
+}
+
+void RelationStatisticsHelper::UpdateDistinctCounts(RelationStats &stats, const vector<column_t> &column_ids,
+                                                    const vector<FilterSelectivity> &filters, idx_t cardinality) {
+	for (auto &filter : filters) {
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			if (column_ids[i] != filter.column_index) {
+				continue;
+			}
+			auto &distinct_count = stats.column_distinct_count[i].distinct_count;
+			if (filter.is_equality) {
+				distinct_count = 1;
+			} else {
+				distinct_count =
+				    MaxValue<idx_t>(LossyNumericCast<idx_t>(double(distinct_count) * filter.selectivity), 1U);
+			}
+		}
+	}
+	// a column can never have more distinct values than the relation has rows
+	for (auto &distinct_count : stats.column_distinct_count) {
+		distinct_count.distinct_count = MinValue(distinct_count.distinct_count, MaxValue<idx_t>(cardinality, 1));
+	}
+}
+
 RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientContext &context) {
 	auto return_stats = RelationStats();
 
@@ -106,11 +264,28 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 
 	if (!get.table_filters.filters.empty()) {
 		column_statistics = nullptr;
+		// the histograms (built by ANALYZE) are only available for DuckDB tables
+		optional_ptr<DataTable> storage;
+		if (catalog_table && catalog_table->IsDuckTable()) {
+			storage = &catalog_table->GetStorage();
+		}
+		vector<FilterSelectivity> histogram_selectivities;
 		for (auto &it : get.table_filters.filters) {
 			if (get.bind_data && get.function.statistics) {
 				column_statistics = get.function.statistics(context, get.bind_data.get(), it.first);
 			}
 
+			if (column_statistics && storage) {
+				auto &column = catalog_table->GetColumn(LogicalIndex(it.first));
+				auto histogram = storage->GetHistogram(column.StorageOid());
+				FilterSelectivity selectivity;
+				if (histogram && TryEstimateSelectivity(*it.second, *histogram, *column_statistics, selectivity)) {
+					selectivity.column_index = it.first;
+					selectivity.storage_index = column.StorageOid();
+					histogram_selectivities.push_back(selectivity);
+					continue;
+				}
+			}
 			if (column_statistics && it.second->filter_type == TableFilterType::CONJUNCTION_AND) {
 				auto &filter = it.second->Cast<ConjunctionAndFilter>();
 				idx_t cardinality_with_and_filter = RelationStatisticsHelper::InspectConjunctionAND(
@@ -121,11 +296,18 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		// if the above code didn't find an equality filter (i.e country_code = "[us]")
 		// and there are other table filters (i.e cost > 50), use default selectivity.
 		bool has_equality_filter = (cardinality_after_filters != base_table_cardinality);
-		if (!has_equality_filter && !get.table_filters.filters.empty()) {
+		bool has_other_filters = histogram_selectivities.size() < get.table_filters.filters.size();
+		if (!has_equality_filter && has_other_filters) {
 			cardinality_after_filters = MaxValue<idx_t>(
 			    LossyNumericCast<idx_t>(double(base_table_cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY),
 			    1U);
 		}
+		if (!histogram_selectivities.empty()) {
+			auto selectivity = CombineSelectivities(histogram_selectivities, storage->GetColumnDependencies());
+			cardinality_after_filters =
+			    MaxValue<idx_t>(LossyNumericCast<idx_t>(double(cardinality_after_filters) * selectivity), 1U);
+			UpdateDistinctCounts(return_stats, column_ids, histogram_selectivities, cardinality_after_filters);
+		}
 		if (base_table_cardinality == 0) {
 			cardinality_after_filters = 0;
 		}
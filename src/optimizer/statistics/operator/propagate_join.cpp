@@ -17,6 +17,7 @@ namespace duckdb {
 void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, unique_ptr<LogicalOperator> &node_ptr) {
 	for (idx_t i = 0; i < join.conditions.size(); i++) {
 		auto &condition = join.conditions[i];
+		optional_idx join_stats_idx;
 		const auto stats_left = PropagateExpression(condition.left);
 		const auto stats_right = PropagateExpression(condition.right);
 		if (stats_left && stats_right) {
@@ -29,6 +30,7 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			}
 			auto prune_result = PropagateComparison(*stats_left, *stats_right, condition.comparison);
 			// Add stats to logical_join for perfect hash join
+			join_stats_idx = join.join_stats.size();
 			join.join_stats.push_back(stats_left->ToUnique());
 			join.join_stats.push_back(stats_right->ToUnique());
 			switch (prune_result) {
@@ -163,9 +165,9 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			}
 
 			// Update join_stats when is already part of the join
-			if (join.join_stats.size() == 2) {
-				join.join_stats[0] = std::move(updated_stats_left);
-				join.join_stats[1] = std::move(updated_stats_right);
+			if (join_stats_idx.IsValid() && updated_stats_left && updated_stats_right) {
+				join.join_stats[join_stats_idx.GetIndex()] = std::move(updated_stats_left);
+				join.join_stats[join_stats_idx.GetIndex() + 1] = std::move(updated_stats_right);
 			}
 			break;
 		}
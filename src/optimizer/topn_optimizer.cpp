@@ -1,8 +1,12 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +36,72 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// pushdown dynamic filters through the child of the Top-N into the table scan
+	// we only push the first order column, and only if NULL values sort last - otherwise NULLs would be filtered out
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	// follow the column through projections and filters, which do not change the values of the column
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &current = child.get();
+		if (current.type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &proj = current.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+		} else if (current.type != LogicalOperatorType::LOGICAL_FILTER) {
+			return;
+		}
+		child = *current.children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.filter_pushdown) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || IsRowIdColumnId(column_ids[binding.column_index])) {
+		return;
+	}
+	// rows that are worse than the current boundary value can never end up in the Top-N
+	// we keep rows that are equal to the boundary value, since they can be needed to break ties on later columns
+	auto comparison_type = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	auto filter_data = make_shared_ptr<DynamicFilterData>(comparison_type);
+	get.table_filters.PushFilter(column_ids[binding.column_index], make_uniq<DynamicFilter>(filter_data));
+	op.dynamic_filter = std::move(filter_data);
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,6 +132,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
@@ -2,11 +2,13 @@
 
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/set/physical_cte.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline_complete_event.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
@@ -16,6 +18,7 @@
 #include "duckdb/parallel/pipeline_prepare_finish_event.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -382,7 +385,62 @@ void Executor::Initialize(PhysicalOperator &plan) {
 	InitializeInternal(plan);
 }
 
+static idx_t EstimateRowWidth(const vector<LogicalType> &types) {
+	// every materialized row has a hash and a pointer to the next row in its chain
+	idx_t width = sizeof(hash_t) + sizeof(data_ptr_t);
+	for (auto &type : types) {
+		auto physical_type = type.InternalType();
+		width += TypeIsConstantSize(physical_type) ? GetTypeIdSize(physical_type) : 2 * sizeof(string_t);
+	}
+	return width;
+}
+
+static double EstimateMaterializedSize(idx_t cardinality, const vector<LogicalType> &types) {
+	return static_cast<double>(cardinality) * static_cast<double>(EstimateRowWidth(types));
+}
+
+//! Estimates the memory the operators of the plan need to materialize their intermediates
+static double EstimateQueryMemory(PhysicalOperator &op) {
+	double result = 0;
+	switch (op.type) {
+	case PhysicalOperatorType::HASH_JOIN:
+		// the hash table is built on the right side
+		result += EstimateMaterializedSize(op.children[1]->estimated_cardinality, op.children[1]->types);
+		break;
+	case PhysicalOperatorType::HASH_GROUP_BY:
+	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
+		// the number of groups
+		result += EstimateMaterializedSize(op.estimated_cardinality, op.types);
+		break;
+	case PhysicalOperatorType::ORDER_BY:
+	case PhysicalOperatorType::WINDOW:
+		result += EstimateMaterializedSize(op.children[0]->estimated_cardinality, op.children[0]->types);
+		break;
+	default:
+		break;
+	}
+	for (auto &child : op.children) {
+		result += EstimateQueryMemory(*child);
+	}
+	return result;
+}
+
+void Executor::AdmitQuery(PhysicalOperator &plan) {
+	if (!DBConfig::GetConfig(context).options.enable_query_admission) {
+		return;
+	}
+	auto estimated_memory = EstimateQueryMemory(plan);
+	if (estimated_memory < 1) {
+		// nothing is materialized, there is no need to wait
+		return;
+	}
+	auto max_memory = static_cast<double>(NumericLimits<idx_t>::Maximum() / 2);
+	admission = TemporaryMemoryManager::Get(context).AdmitQuery(
+	    context, LossyNumericCast<idx_t>(MinValue<double>(estimated_memory, max_memory)));
+}
+
 void Executor::InitializeInternal(PhysicalOperator &plan) {
+	AdmitQuery(plan);
 
 	auto &scheduler = TaskScheduler::GetScheduler(context);
 	{
@@ -391,7 +449,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(context);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -421,8 +479,90 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		// finally, verify and schedule
 		VerifyPipelines();
-		ScheduleEvents(to_schedule);
+		if (CanExecuteInline(to_schedule)) {
+			// the plan is tiny: instead of scheduling events, it is executed on the calling thread in ExecuteTask
+			inline_pipeline = to_schedule[0]->GetBasePipeline();
+		} else {
+			ScheduleEvents(to_schedule);
+		}
+	}
+}
+
+bool Executor::CanExecuteInline(const vector<shared_ptr<MetaPipeline>> &meta_pipelines) {
+	if (!HasResultCollector() || HasStreamingResultCollector() || !recursive_ctes.empty()) {
+		return false;
+	}
+	if (ClientConfig::GetConfig(context).verify_parallelism) {
+		// we want to exercise the parallel execution of the plan
+		return false;
+	}
+	if (meta_pipelines.size() != 1) {
+		return false;
+	}
+	vector<shared_ptr<Pipeline>> meta_pipeline_pipelines;
+	meta_pipelines[0]->GetPipelines(meta_pipeline_pipelines, false);
+	if (meta_pipeline_pipelines.size() != 1) {
+		return false;
+	}
+	auto &pipeline = *meta_pipeline_pipelines[0];
+	if (pipeline.GetSink().get() != physical_plan.get()) {
+		return false;
+	}
+	auto source = pipeline.GetSource();
+	if (source->type != PhysicalOperatorType::TABLE_SCAN) {
+		return false;
+	}
+	// the estimated cardinality of the scan can include the selectivity of its filters
+	// we ask the table function how many rows it emits instead, e.g., the number of row ids found by an index scan
+	// only the scans of DuckDB tables report an upper bound that we can rely on
+	auto &scan = source->Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" && scan.function.name != "index_scan") {
+		return false;
 	}
+	auto node_stats = scan.function.cardinality(context, scan.bind_data.get());
+	if (!node_stats || !node_stats->has_max_cardinality) {
+		return false;
+	}
+	return node_stats->max_cardinality <= INLINE_EXECUTION_THRESHOLD;
+}
+
+void Executor::ExecuteInline() {
+	D_ASSERT(inline_pipeline);
+	auto &pipeline = *inline_pipeline;
+	try {
+		if (!inline_executor) {
+			pipeline.Reset();
+			inline_signal = make_shared_ptr<InterruptDoneSignalState>();
+			inline_executor = make_uniq<PipelineExecutor>(context, pipeline);
+			inline_executor->SetSignalForInterrupts(inline_signal);
+		}
+		// the source emits few rows, so we execute the pipeline to completion
+		auto result = inline_executor->Execute();
+		if (result == PipelineExecuteResult::INTERRUPTED) {
+			// there is no task that can be rescheduled: wait until the operator is no longer blocked
+			inline_signal->Await();
+			return;
+		}
+		inline_executor.reset();
+
+		// finalize the sink, this is what the PipelineFinishEvent does for scheduled pipelines
+		pipeline.PrepareFinalize();
+		auto sink = pipeline.GetSink();
+		auto finish_event = make_shared_ptr<PipelineFinishEvent>(inline_pipeline);
+		InterruptState interrupt_state(inline_signal);
+		OperatorSinkFinalizeInput finalize_input {*sink->sink_state, interrupt_state};
+		auto finalize_result = sink->Finalize(pipeline, *finish_event, context, finalize_input);
+		while (finalize_result == SinkFinalizeType::BLOCKED) {
+			inline_signal->Await();
+			finalize_result = sink->Finalize(pipeline, *finish_event, context, finalize_input);
+		}
+		sink->sink_state->state = finalize_result;
+		CompletePipeline();
+	} catch (std::exception &ex) {
+		PushError(ErrorData(ex));
+	} catch (...) { // LCOV_EXCL_START
+		PushError(ErrorData("Unknown exception in inline pipeline!"));
+	} // LCOV_EXCL_STOP
 }
 
 void Executor::CancelTasks() {
@@ -437,6 +577,8 @@ void Executor::CancelTasks() {
 			auto &rec_cte = rec_cte_ref.get().Cast<PhysicalRecursiveCTE>();
 			rec_cte.recursive_meta_pipeline.reset();
 		}
+		inline_executor.reset();
+		inline_pipeline.reset();
 		pipelines.clear();
 		root_pipelines.clear();
 		to_be_rescheduled_tasks.clear();
@@ -446,6 +588,7 @@ void Executor::CancelTasks() {
 	while (executor_tasks > 0) {
 		WorkOnTasks();
 	}
+	admission.reset();
 }
 
 void Executor::WorkOnTasks() {
@@ -542,6 +685,18 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 	if (execution_result != PendingExecutionResult::RESULT_NOT_READY && ExecutionIsFinished()) {
 		return execution_result;
 	}
+	if (inline_pipeline && completed_pipelines < total_pipelines) {
+		// the plan is executed on the calling thread: there are no tasks to fetch
+		if (!dry_run) {
+			ExecuteInline();
+		}
+		if (!HasError()) {
+			return PendingExecutionResult::RESULT_NOT_READY;
+		}
+		execution_result = PendingExecutionResult::EXECUTION_ERROR;
+		CancelTasks();
+		ThrowException();
+	}
 	// check if there are any incomplete pipelines
 	auto &scheduler = TaskScheduler::GetScheduler(context);
 	if (completed_pipelines < total_pipelines) {
@@ -596,6 +751,7 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 	D_ASSERT(!task);
 
 	lock_guard<mutex> elock(executor_lock);
+	inline_pipeline.reset();
 	pipelines.clear();
 	NextExecutor();
 	if (HasError()) { // LCOV_EXCL_START
@@ -604,16 +760,22 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 		ThrowException();
 	} // LCOV_EXCL_STOP
 	execution_result = PendingExecutionResult::EXECUTION_FINISHED;
+	admission.reset();
 	return execution_result;
 }
 
 void Executor::Reset() {
 	lock_guard<mutex> elock(executor_lock);
 	physical_plan = nullptr;
+	admission.reset();
 	cancelled = false;
 	owned_plan.reset();
 	root_executor.reset();
+	inline_executor.reset();
+	inline_pipeline.reset();
+	inline_signal.reset();
 	root_pipelines.clear();
+	recursive_ctes.clear();
 	root_pipeline_idx = 0;
 	completed_pipelines = 0;
 	total_pipelines = 0;
@@ -660,6 +822,10 @@ bool Executor::HasError() {
 	return error_manager.HasError();
 }
 
+bool Executor::HasOnlyErrorsOfType(ExceptionType type) {
+	return error_manager.HasOnlyErrorsOfType(type);
+}
+
 ErrorData Executor::GetError() {
 	return error_manager.GetError();
 }
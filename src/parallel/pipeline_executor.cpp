@@ -446,6 +446,10 @@ void PipelineExecutor::SetTaskForInterrupts(weak_ptr<Task> current_task) {
 	interrupt_state = InterruptState(std::move(current_task));
 }
 
+void PipelineExecutor::SetSignalForInterrupts(weak_ptr<InterruptDoneSignalState> done_signal) {
+	interrupt_state = InterruptState(std::move(done_signal));
+}
+
 SourceResultType PipelineExecutor::GetData(DataChunk &chunk, OperatorSourceInput &input) {
 	//! Testing feature to enable async source on every operator
 #ifdef DUCKDB_DEBUG_ASYNC_SINK_SOURCE
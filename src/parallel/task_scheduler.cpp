@@ -1,8 +1,10 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -34,16 +36,23 @@ struct SchedulerThread {
 #endif
 };
 
+//! A task in the shared queue, together with the producer that scheduled it
+struct QueuedTask {
+	shared_ptr<Task> task;
+	shared_ptr<ProducerQueueInfo> info;
+};
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(const shared_ptr<ProducerQueueInfo> &info, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerQueueInfo &info, shared_ptr<Task> &task);
+	bool Dequeue(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info);
 };
 
 struct QueueProducerToken {
@@ -53,41 +62,69 @@ struct QueueProducerToken {
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+void ConcurrentQueue::Enqueue(const shared_ptr<ProducerQueueInfo> &info, shared_ptr<Task> task) {
+	lock_guard<mutex> producer_lock(info->producer_lock);
+	info->pending_tasks++;
+	if (q.enqueue(info->token->queue_token, QueuedTask {std::move(task), info})) {
 		semaphore.signal();
 	} else {
+		info->pending_tasks--;
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+bool ConcurrentQueue::DequeueFromProducer(ProducerQueueInfo &info, shared_ptr<Task> &task) {
+	lock_guard<mutex> producer_lock(info.producer_lock);
+	QueuedTask queued;
+	if (!q.try_dequeue_from_producer(info.token->queue_token, queued)) {
+		return false;
+	}
+	info.pending_tasks--;
+	task = std::move(queued.task);
+	return true;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info) {
+	QueuedTask queued;
+	if (!q.try_dequeue(queued)) {
+		return false;
+	}
+	queued.info->pending_tasks--;
+	task = std::move(queued.task);
+	info = std::move(queued.info);
+	return true;
 }
 
 #else
 struct ConcurrentQueue {
-	std::queue<shared_ptr<Task>> q;
+	std::queue<QueuedTask> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(const shared_ptr<ProducerQueueInfo> &info, shared_ptr<Task> task);
+	bool DequeueFromProducer(ProducerQueueInfo &info, shared_ptr<Task> &task);
+	bool Dequeue(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(const shared_ptr<ProducerQueueInfo> &info, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
-	q.push(std::move(task));
+	info->pending_tasks++;
+	q.push(QueuedTask {std::move(task), info});
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerQueueInfo &info, shared_ptr<Task> &task) {
+	shared_ptr<ProducerQueueInfo> queued_info;
+	return Dequeue(task, queued_info);
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
 	}
-	task = std::move(q.front());
+	task = std::move(q.front().task);
+	info = std::move(q.front().info);
 	q.pop();
+	info->pending_tasks--;
 	return true;
 }
 
@@ -97,15 +134,74 @@ struct QueueProducerToken {
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerQueueInfo::ProducerQueueInfo(unique_ptr<QueueProducerToken> token_p, idx_t producer_id,
+                                     optional_idx query_id, idx_t priority, idx_t max_threads)
+    : producer_id(producer_id), query_id(query_id), priority(priority), max_threads(max_threads),
+      token(std::move(token_p)), pending_tasks(0), local_tasks(0), active_tasks(0), completed_tasks(0), pass(0) {
+}
+
+ProducerQueueInfo::~ProducerQueueInfo() {
+}
+
+bool ProducerQueueInfo::IsWeighted() const {
+	return priority != 1 || max_threads != 0;
+}
+
+idx_t ProducerQueueInfo::Stride() const {
+	return MaxValue<idx_t>(STRIDE_SCALE / priority, 1);
+}
+
+static bool AtThreadLimit(const ProducerQueueInfo &info) {
+	return info.max_threads != 0 && info.active_tasks >= info.max_threads;
+}
+
+//! Raises "value" to at least "minimum"
+static idx_t AtomicMax(atomic<idx_t> &value, idx_t minimum) {
+	auto current = value.load();
+	while (current < minimum && !value.compare_exchange_weak(current, minimum)) {
+	}
+	return MaxValue(current, minimum);
+}
+
+struct LocalTask {
+	shared_ptr<Task> task;
+	shared_ptr<ProducerQueueInfo> info;
+};
+
+//! The local task queue of a background thread
+//! The thread takes the newest task from the back, other threads steal the oldest task from the front
+struct WorkerQueue {
+	WorkerQueue(TaskScheduler &scheduler, idx_t worker_id) : scheduler(scheduler), worker_id(worker_id) {
+	}
+
+	TaskScheduler &scheduler;
+	const idx_t worker_id;
+	mutex lock;
+	deque<LocalTask> tasks;
+};
+
+#ifndef DUCKDB_NO_THREADS
+//! The local task queue of the background thread that is running on this thread, if any
+static thread_local WorkerQueue *current_worker = nullptr;
+#endif
+
+//! Whether the worker has a task at the back of its local queue that it can pick up
+static bool HasLocalTask(WorkerQueue &worker) {
+	lock_guard<mutex> worker_guard(worker.lock);
+	return !worker.tasks.empty() && !AtThreadLimit(*worker.tasks.back().info);
+}
+
+ProducerToken::ProducerToken(TaskScheduler &scheduler, shared_ptr<ProducerQueueInfo> info)
+    : scheduler(scheduler), info(std::move(info)) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.RemoveProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>()), producer_id(0), weighted_producers(0), virtual_time(0),
+      local_task_count(0), work_stealing(db.config.options.scheduler_work_stealing),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
       current_thread_count(1) {
@@ -131,27 +227,267 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 }
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
+	return CreateProducer(optional_idx(), 1, 0);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	optional_idx query_id;
+	if (context.transaction.HasActiveTransaction() && context.transaction.GetActiveQuery() != MAXIMUM_QUERY_ID) {
+		query_id = context.transaction.GetActiveQuery();
+	}
+	return CreateProducer(query_id, config.query_priority, config.max_query_threads);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(optional_idx query_id, idx_t priority,
+                                                        idx_t max_threads) {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	lock_guard<mutex> guard(queue_lock);
+	auto info = make_shared_ptr<ProducerQueueInfo>(std::move(token), producer_id++, query_id, priority, max_threads);
+	info->pass = virtual_time.load();
+	if (info->IsWeighted()) {
+		weighted_producers++;
+	}
+	auto result = make_uniq<ProducerToken>(*this, std::move(info));
+	producers.push_back(result->info);
+	return result;
+}
+
+void TaskScheduler::RemoveProducer(ProducerToken &producer) {
+	lock_guard<mutex> guard(queue_lock);
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (producers[i].get() == producer.info.get()) {
+			if (producer.info->IsWeighted()) {
+				weighted_producers--;
+			}
+			producers.erase_at(i);
+			return;
+		}
+	}
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+	if (work_stealing && task->worker_hint.IsValid()) {
+		// A blocked task is rescheduled: queue it on the thread that executed it before
+		{
+			lock_guard<mutex> guard(queue_lock);
+			auto &worker = *worker_queues[task->worker_hint.GetIndex()];
+			lock_guard<mutex> worker_guard(worker.lock);
+			token.info->local_tasks++;
+			local_task_count++;
+			worker.tasks.push_back(LocalTask {std::move(task), token.info});
+		}
+		Signal(1);
+		return;
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (work_stealing && current_worker && &current_worker->scheduler == this && weighted_producers == 0) {
+		// A task scheduled from a background thread (e.g. the first task of the next pipeline, scheduled when the
+		// thread finished the last task of the previous one) is picked up by the same thread, which still has the
+		// data of the previous task in its caches. Only one task is kept locally, the others go to the shared queue.
+		// This is skipped when producers have a priority or a thread limit, so these still apply to all new tasks.
+		auto &worker = *current_worker;
+		lock_guard<mutex> worker_guard(worker.lock);
+		if (worker.tasks.empty()) {
+			token.info->local_tasks++;
+			local_task_count++;
+			worker.tasks.push_back(LocalTask {std::move(task), token.info});
+			return;
+		}
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(token.info, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(*token.info, task)) {
+		return true;
+	}
+	if (token.info->local_tasks == 0) {
+		return false;
+	}
+	// The remaining tasks of the producer are in the local queues of the threads
+	lock_guard<mutex> guard(queue_lock);
+	shared_ptr<ProducerQueueInfo> info;
+	return StealTask(task, info, nullptr, token.info.get());
+}
+
+bool TaskScheduler::StealTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info,
+                              optional_ptr<WorkerQueue> worker, optional_ptr<ProducerQueueInfo> producer) {
+	for (auto &victim : worker_queues) {
+		if (victim.get() == worker.get()) {
+			continue;
+		}
+		lock_guard<mutex> worker_guard(victim->lock);
+		for (auto it = victim->tasks.begin(); it != victim->tasks.end(); it++) {
+			if (producer ? it->info.get() != producer.get() : AtThreadLimit(*it->info)) {
+				continue;
+			}
+			task = std::move(it->task);
+			info = std::move(it->info);
+			victim->tasks.erase(it);
+			info->local_tasks--;
+			local_task_count--;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::DequeueFairTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info,
+                                    bool &any_pending) {
+	// Stride scheduling: pick the producer with the lowest virtual time among the ones that have tasks and are
+	// below their thread limit, so every query gets a share of the threads proportional to its priority
+	static constexpr const idx_t MAX_ATTEMPTS = 8;
+	for (idx_t attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+		shared_ptr<ProducerQueueInfo> best;
+		idx_t best_pass = 0;
+		{
+			// The lock only protects the registry of producers, the tasks are dequeued after releasing it
+			lock_guard<mutex> guard(queue_lock);
+			const auto current_time = virtual_time.load();
+			for (auto &producer_info : producers) {
+				if (producer_info->pending_tasks == 0) {
+					continue;
+				}
+				any_pending = true;
+				if (AtThreadLimit(*producer_info)) {
+					continue;
+				}
+				// Producers that were idle do not get to catch up on the time they did not use
+				const auto pass = AtomicMax(producer_info->pass, current_time);
+				if (!best || pass < best_pass) {
+					best = producer_info;
+					best_pass = pass;
+				}
+			}
+		}
+		if (!best) {
+			return false;
+		}
+		if (queue->DequeueFromProducer(*best, task)) {
+			AtomicMax(virtual_time, best_pass);
+			best->pass += best->Stride();
+			info = std::move(best);
+			return true;
+		}
+		// Another thread took the last task of the producer in the meantime
+	}
+	return false;
+}
+
+bool TaskScheduler::DequeueTask(shared_ptr<Task> &task, shared_ptr<ProducerQueueInfo> &info,
+                                optional_ptr<WorkerQueue> worker) {
+	if (worker) {
+		// Tasks that were rescheduled on this thread come first
+		lock_guard<mutex> worker_guard(worker->lock);
+		if (!worker->tasks.empty() && !AtThreadLimit(*worker->tasks.back().info)) {
+			task = std::move(worker->tasks.back().task);
+			info = std::move(worker->tasks.back().info);
+			worker->tasks.pop_back();
+			info->local_tasks--;
+			local_task_count--;
+			info->active_tasks++;
+			return true;
+		}
+	}
+	bool any_pending = false;
+	if (weighted_producers == 0) {
+		// All producers have the same priority and no thread limit: take the next task from the lock-free queue
+		if (queue->Dequeue(task, info)) {
+			info->active_tasks++;
+			return true;
+		}
+	} else if (DequeueFairTask(task, info, any_pending)) {
+		info->active_tasks++;
+		return true;
+	}
+	if (local_task_count > 0) {
+		lock_guard<mutex> guard(queue_lock);
+		if (StealTask(task, info, worker, nullptr)) {
+			info->active_tasks++;
+			return true;
+		}
+	}
+	if (any_pending) {
+		// The remaining tasks belong to producers that are at their thread limit
+		return false;
+	}
+	// Tasks of producers that no longer exist
+	if (queue->Dequeue(task, info)) {
+		info->active_tasks++;
+		return true;
+	}
+	return false;
+}
+
+struct ActiveTaskGuard {
+	ActiveTaskGuard(TaskScheduler &scheduler, const shared_ptr<ProducerQueueInfo> &info)
+	    : scheduler(scheduler), info(info) {
+	}
+	~ActiveTaskGuard() {
+		if (!info) {
+			return;
+		}
+		info->active_tasks--;
+		info->completed_tasks++;
+		if (info->max_threads != 0 && info->pending_tasks > 0) {
+			// A thread might have skipped the tasks of this producer because it was at its limit
+			scheduler.Signal(1);
+		}
+	}
+
+	TaskScheduler &scheduler;
+	const shared_ptr<ProducerQueueInfo> &info;
+};
+
+TaskExecutionResult TaskScheduler::ExecuteTask(shared_ptr<Task> &task, const shared_ptr<ProducerQueueInfo> &info,
+                                               optional_ptr<WorkerQueue> worker) {
+	ActiveTaskGuard guard(*this, info);
+	auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+	switch (execute_result) {
+	case TaskExecutionResult::TASK_FINISHED:
+	case TaskExecutionResult::TASK_ERROR:
+		task.reset();
+		break;
+	case TaskExecutionResult::TASK_NOT_FINISHED:
+		throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
+	case TaskExecutionResult::TASK_BLOCKED:
+		task->worker_hint = worker ? optional_idx(worker->worker_id) : optional_idx();
+		task->Deschedule();
+		task.reset();
+		break;
+	}
+	return execute_result;
+}
+
+vector<ProducerQueueStatus> TaskScheduler::GetQueueStatus() {
+	vector<ProducerQueueStatus> result;
+	lock_guard<mutex> guard(queue_lock);
+	for (auto &producer : producers) {
+		auto &info = *producer;
+		result.push_back({info.producer_id, info.query_id, info.priority, info.max_threads, info.pending_tasks.load(),
+		                  info.local_tasks.load(), info.active_tasks.load(), info.completed_tasks.load()});
+	}
+	return result;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+	ExecuteForever(marker, nullptr);
+}
+
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, optional_ptr<WorkerQueue> worker) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	current_worker = worker.get();
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush() || allocator_background_threads) {
+		if (worker && HasLocalTask(*worker)) {
+			// the thread scheduled a task for itself, pick it up without waiting for a signal
+		} else if (!Allocator::SupportsFlush() || allocator_background_threads) {
 			// allocator can't flush, or background threads clean up allocations, just start an untimed wait
 			queue->semaphore.wait();
 		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
@@ -164,23 +500,12 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+		shared_ptr<ProducerQueueInfo> info;
+		if (DequeueTask(task, info, worker)) {
+			ExecuteTask(task, info, worker);
 		}
 	}
+	current_worker = nullptr;
 	// this thread will exit, flush all of its outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(0);
@@ -197,23 +522,13 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		shared_ptr<ProducerQueueInfo> info;
+		if (!DequeueTask(task, info, nullptr)) {
 			return completed_tasks;
 		}
-		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-		switch (execute_result) {
-		case TaskExecutionResult::TASK_FINISHED:
-		case TaskExecutionResult::TASK_ERROR:
-			task.reset();
+		auto execute_result = ExecuteTask(task, info, nullptr);
+		if (execute_result != TaskExecutionResult::TASK_BLOCKED) {
 			completed_tasks++;
-			break;
-		case TaskExecutionResult::TASK_NOT_FINISHED:
-			throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-		case TaskExecutionResult::TASK_BLOCKED:
-			task->Deschedule();
-			task.reset();
-			break;
 		}
 	}
 	return completed_tasks;
@@ -227,23 +542,12 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		shared_ptr<ProducerQueueInfo> info;
+		if (!DequeueTask(task, info, nullptr)) {
 			return;
 		}
 		try {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+			ExecuteTask(task, info, nullptr);
 		} catch (...) {
 			return;
 		}
@@ -254,8 +558,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *worker) {
+	scheduler->ExecuteForever(marker, worker);
 }
 #endif
 
@@ -289,6 +593,10 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetWorkStealing(bool enable) {
+	work_stealing = enable;
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -364,9 +672,19 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			// every thread gets its own local task queue, which is reused by the thread with the same index
+			WorkerQueue *worker;
+			{
+				lock_guard<mutex> guard(queue_lock);
+				auto worker_id = threads.size();
+				if (worker_id == worker_queues.size()) {
+					worker_queues.push_back(make_uniq<WorkerQueue>(*this, worker_id));
+				}
+				worker = worker_queues[worker_id].get();
+			}
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), worker);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
@@ -348,11 +348,25 @@ BindResult BaseSelectBinder::BindWindow(WindowExpression &window, idx_t depth) {
 	result->end = window.end;
 	result->exclude_clause = window.exclude_clause;
 
+	// check if this window expression already exists, so identical windows are only computed once
+	idx_t window_idx;
+	auto entry = result->IsVolatile() ? node.window_map.end() : node.window_map.find(*result);
+	if (entry == node.window_map.end()) {
+		// new window: insert into window list
+		window_idx = node.windows.size();
+		if (!result->IsVolatile()) {
+			node.window_map[*result] = window_idx;
+		}
+		// move the WINDOW expression into the set of bound windows
+		node.windows.push_back(std::move(result));
+	} else {
+		// duplicate window: simply refer to the existing window
+		window_idx = entry->second;
+	}
+
 	// create a BoundColumnRef that references this entry
-	auto colref = make_uniq<BoundColumnRefExpression>(std::move(name), result->return_type,
-	                                                  ColumnBinding(node.window_index, node.windows.size()), depth);
-	// move the WINDOW expression into the set of bound windows
-	node.windows.push_back(std::move(result));
+	auto colref = make_uniq<BoundColumnRefExpression>(std::move(name), node.windows[window_idx]->return_type,
+	                                                  ColumnBinding(node.window_index, window_idx), depth);
 	return BindResult(std::move(colref));
 }
 
@@ -0,0 +1,75 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter_data->filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		// the filter can still become more selective later on - we cannot skip evaluating it
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (filter_data) {
+		lock_guard<mutex> l(filter_data->lock);
+		if (filter_data->initialized) {
+			return "Dynamic Filter (" + filter_data->filter->ToString(column_name) + ")";
+		}
+	}
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the filter is an optimization only - the constant is not known up front, so it is always true
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// copies share the filter data, so they observe the same updates
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p) : comparison_type(comparison_type_p) {
+}
+
+void DynamicFilterData::SetValue(Value val) {
+	if (val.IsNull()) {
+		return;
+	}
+	auto new_filter = make_uniq<ConstantFilter>(comparison_type, std::move(val));
+	lock_guard<mutex> l(lock);
+	filter = std::move(new_filter);
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	initialized = false;
+}
+
+} // namespace duckdb
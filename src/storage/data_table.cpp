@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0), row_change_count(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -1382,6 +1383,26 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+shared_ptr<ColumnHistogram> DataTable::GetHistogram(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	return row_groups->GetHistogram(column_id);
+}
+
+void DataTable::SetHistogram(column_t column_id, shared_ptr<ColumnHistogram> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetHistogram(column_id, std::move(histogram));
+}
+
+vector<ColumnDependency> DataTable::GetColumnDependencies() {
+	return row_groups->GetColumnDependencies();
+}
+
+void DataTable::SetColumnDependencies(vector<ColumnDependency> dependencies) {
+	row_groups->SetColumnDependencies(std::move(dependencies));
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
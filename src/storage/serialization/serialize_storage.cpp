@@ -9,6 +9,8 @@
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/column_histogram.hpp"
+#include "duckdb/storage/statistics/column_dependency.hpp"
 
 namespace duckdb {
 
@@ -24,6 +26,35 @@ BlockPointer BlockPointer::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void ColumnDependency::Serialize(Serializer &serializer) const {
+	serializer.WritePropertyWithDefault<idx_t>(100, "determinant", determinant);
+	serializer.WritePropertyWithDefault<idx_t>(101, "dependent", dependent);
+	serializer.WriteProperty<double>(102, "degree", degree);
+}
+
+ColumnDependency ColumnDependency::Deserialize(Deserializer &deserializer) {
+	ColumnDependency result;
+	deserializer.ReadPropertyWithDefault<idx_t>(100, "determinant", result.determinant);
+	deserializer.ReadPropertyWithDefault<idx_t>(101, "dependent", result.dependent);
+	deserializer.ReadProperty<double>(102, "degree", result.degree);
+	return result;
+}
+
+void ColumnHistogram::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<double>(100, "null_fraction", null_fraction);
+	serializer.WritePropertyWithDefault<vector<MostCommonValue>>(101, "most_common_values", most_common_values);
+	serializer.WritePropertyWithDefault<vector<double>>(102, "bounds", bounds);
+}
+
+unique_ptr<ColumnHistogram> ColumnHistogram::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<ColumnHistogram>(new ColumnHistogram());
+	deserializer.ReadProperty<double>(100, "null_fraction", result->null_fraction);
+	deserializer.ReadPropertyWithDefault<vector<MostCommonValue>>(101, "most_common_values",
+	                                                              result->most_common_values);
+	deserializer.ReadPropertyWithDefault<vector<double>>(102, "bounds", result->bounds);
+	return result;
+}
+
 void DataPointer::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<uint64_t>(100, "row_start", row_start);
 	serializer.WritePropertyWithDefault<uint64_t>(101, "tuple_count", tuple_count);
@@ -110,4 +141,18 @@ MetaBlockPointer MetaBlockPointer::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void MostCommonValue::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<hash_t>(100, "hash", hash);
+	serializer.WriteProperty<double>(101, "value", value);
+	serializer.WriteProperty<double>(102, "frequency", frequency);
+}
+
+MostCommonValue MostCommonValue::Deserialize(Deserializer &deserializer) {
+	MostCommonValue result;
+	deserializer.ReadProperty<hash_t>(100, "hash", result.hash);
+	deserializer.ReadProperty<double>(101, "value", result.value);
+	deserializer.ReadProperty<double>(102, "frequency", result.frequency);
+	return result;
+}
+
 } // namespace duckdb
@@ -0,0 +1,51 @@
+#include "duckdb/storage/statistics/column_dependency.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace duckdb {
+
+vector<ColumnDependency> ColumnDependency::Compute(const vector<idx_t> &columns, const vector<vector<hash_t>> &hashes,
+                                                   idx_t count) {
+	D_ASSERT(columns.size() == hashes.size());
+	vector<ColumnDependency> result;
+	if (count == 0) {
+		return result;
+	}
+	vector<idx_t> order(count);
+	for (idx_t determinant = 0; determinant < columns.size(); determinant++) {
+		// group the sampled rows by the value of the determinant
+		auto &determinant_hashes = hashes[determinant];
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(),
+		          [&](idx_t a, idx_t b) { return determinant_hashes[a] < determinant_hashes[b]; });
+		for (idx_t dependent = 0; dependent < columns.size(); dependent++) {
+			if (dependent == determinant) {
+				continue;
+			}
+			// the degree is the fraction of the rows that are in a group in which the dependent has a single value
+			auto &dependent_hashes = hashes[dependent];
+			idx_t consistent_rows = 0;
+			idx_t group_start = 0;
+			bool consistent = true;
+			for (idx_t i = 1; i <= count; i++) {
+				if (i == count || determinant_hashes[order[i]] != determinant_hashes[order[group_start]]) {
+					if (consistent) {
+						consistent_rows += i - group_start;
+					}
+					group_start = i;
+					consistent = true;
+				} else if (dependent_hashes[order[i]] != dependent_hashes[order[group_start]]) {
+					consistent = false;
+				}
+			}
+			auto degree = static_cast<double>(consistent_rows) / static_cast<double>(count);
+			if (degree >= MIN_DEGREE) {
+				result.push_back(ColumnDependency {columns[determinant], columns[dependent], degree});
+			}
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
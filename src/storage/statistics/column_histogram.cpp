@@ -0,0 +1,233 @@
+#include "duckdb/storage/statistics/column_histogram.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+ColumnHistogram::ColumnHistogram() : null_fraction(0) {
+}
+
+bool ColumnHistogram::TypeIsSupported(const LogicalType &type) {
+	auto physical_type = type.InternalType();
+	return physical_type != PhysicalType::LIST && physical_type != PhysicalType::STRUCT &&
+	       physical_type != PhysicalType::ARRAY;
+}
+
+bool ColumnHistogram::TypeHasBuckets(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ColumnHistogram::TryGetBucketValue(const Value &value, double &result) {
+	if (value.IsNull() || !TypeHasBuckets(value.type())) {
+		return false;
+	}
+	switch (value.type().id()) {
+	case LogicalTypeId::DATE:
+		result = static_cast<double>(value.GetValueUnsafe<int32_t>());
+		break;
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+		result = static_cast<double>(value.GetValueUnsafe<int64_t>());
+		break;
+	default:
+		result = value.GetValue<double>();
+		break;
+	}
+	return Value::IsFinite(result);
+}
+
+unique_ptr<ColumnHistogram> ColumnHistogram::Create(Vector &sample, Vector &hashes, idx_t count) {
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result = make_uniq<ColumnHistogram>();
+	if (count == 0) {
+		return result;
+	}
+	auto has_buckets = TypeHasBuckets(sample.GetType());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	UnifiedVectorFormat vdata;
+	sample.ToUnifiedFormat(count, vdata);
+
+	// count how often every value occurs in the sample
+	struct ValueCount {
+		idx_t count = 0;
+		double value = 0;
+	};
+	unordered_map<hash_t, ValueCount> value_counts;
+	vector<pair<hash_t, double>> bucket_values;
+	idx_t null_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			null_count++;
+			continue;
+		}
+		auto &entry = value_counts[hash_data[i]];
+		entry.count++;
+		double value;
+		// non-finite values are only tracked as (potential) most common values
+		if (has_buckets && TryGetBucketValue(sample.GetValue(i), value)) {
+			entry.value = value;
+			bucket_values.emplace_back(hash_data[i], value);
+		}
+	}
+	auto sample_count = static_cast<double>(count);
+	result->null_fraction = static_cast<double>(null_count) / sample_count;
+	if (value_counts.empty()) {
+		return result;
+	}
+
+	// the most common values are the values that occur noticeably more often than the average value
+	// if the sample holds only a few distinct values, we keep all of them
+	vector<pair<idx_t, hash_t>> candidates;
+	for (auto &entry : value_counts) {
+		candidates.emplace_back(entry.second.count, entry.first);
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const pair<idx_t, hash_t> &a, const pair<idx_t, hash_t> &b) {
+		return a.first > b.first || (a.first == b.first && a.second < b.second);
+	});
+	auto keep_all = candidates.size() <= MAX_MOST_COMMON_VALUES;
+	auto average_count = static_cast<double>(count - null_count) / static_cast<double>(candidates.size());
+	unordered_set<hash_t> most_common_hashes;
+	for (idx_t i = 0; i < candidates.size() && i < MAX_MOST_COMMON_VALUES; i++) {
+		auto value_count = candidates[i].first;
+		if (!keep_all && (value_count < 2 || static_cast<double>(value_count) < average_count * 1.25)) {
+			break;
+		}
+		MostCommonValue most_common_value;
+		most_common_value.hash = candidates[i].second;
+		most_common_value.value = value_counts[candidates[i].second].value;
+		most_common_value.frequency = static_cast<double>(value_count) / sample_count;
+		result->most_common_values.push_back(most_common_value);
+		most_common_hashes.insert(candidates[i].second);
+	}
+	if (!has_buckets) {
+		return result;
+	}
+
+	// the remaining values are divided over buckets that each hold the same number of values
+	vector<double> remaining_values;
+	for (auto &value : bucket_values) {
+		if (most_common_hashes.find(value.first) == most_common_hashes.end()) {
+			remaining_values.push_back(value.second);
+		}
+	}
+	if (remaining_values.empty()) {
+		return result;
+	}
+	std::sort(remaining_values.begin(), remaining_values.end());
+	auto last = remaining_values.size() - 1;
+	auto bucket_count = MaxValue<idx_t>(MinValue<idx_t>(MAX_BUCKETS, last), 1);
+	for (idx_t bucket = 0; bucket <= bucket_count; bucket++) {
+		result->bounds.push_back(remaining_values[bucket * last / bucket_count]);
+	}
+	return result;
+}
+
+double ColumnHistogram::MostCommonFrequency() const {
+	double result = 0;
+	for (auto &most_common_value : most_common_values) {
+		result += most_common_value.frequency;
+	}
+	return result;
+}
+
+double ColumnHistogram::BucketFraction(double value) const {
+	D_ASSERT(bounds.size() >= 2);
+	if (value < bounds.front()) {
+		return 0;
+	}
+	if (value >= bounds.back()) {
+		return 1;
+	}
+	// find the bucket the value falls in, and assume the values are spread uniformly within the bucket
+	auto entry = std::upper_bound(bounds.begin(), bounds.end(), value);
+	auto bucket = NumericCast<idx_t>(entry - bounds.begin()) - 1;
+	auto bucket_fraction = (value - bounds[bucket]) / (bounds[bucket + 1] - bounds[bucket]);
+	return (static_cast<double>(bucket) + bucket_fraction) / static_cast<double>(bounds.size() - 1);
+}
+
+double ColumnHistogram::EstimateEquality(const Value &constant, idx_t distinct_count) const {
+	if (constant.IsNull()) {
+		return 0;
+	}
+	auto hash = constant.Hash();
+	for (auto &most_common_value : most_common_values) {
+		if (most_common_value.hash == hash) {
+			return most_common_value.frequency;
+		}
+	}
+	// the value is not a most common value: spread the remaining rows uniformly over the remaining values
+	auto remaining_fraction = MaxValue<double>(1 - null_fraction - MostCommonFrequency(), 0);
+	auto remaining_distinct =
+	    distinct_count > most_common_values.size() ? distinct_count - most_common_values.size() : 1;
+	auto result = remaining_fraction / static_cast<double>(remaining_distinct);
+	if (!most_common_values.empty()) {
+		result = MinValue(result, most_common_values.back().frequency);
+	}
+	return result;
+}
+
+bool ColumnHistogram::TryEstimateRange(const Value *lower, bool lower_inclusive, const Value *upper,
+                                       bool upper_inclusive, double &result) const {
+	double lower_value = 0;
+	double upper_value = 0;
+	if (lower && !TryGetBucketValue(*lower, lower_value)) {
+		return false;
+	}
+	if (upper && !TryGetBucketValue(*upper, upper_value)) {
+		return false;
+	}
+	result = 0;
+	for (auto &most_common_value : most_common_values) {
+		auto value = most_common_value.value;
+		if (lower && (value < lower_value || (!lower_inclusive && value == lower_value))) {
+			continue;
+		}
+		if (upper && (value > upper_value || (!upper_inclusive && value == upper_value))) {
+			continue;
+		}
+		result += most_common_value.frequency;
+	}
+	if (bounds.size() >= 2) {
+		auto remaining_fraction = MaxValue<double>(1 - null_fraction - MostCommonFrequency(), 0);
+		auto lower_fraction = lower ? BucketFraction(lower_value) : 0;
+		auto upper_fraction = upper ? BucketFraction(upper_value) : 1;
+		result += remaining_fraction * MaxValue<double>(upper_fraction - lower_fraction, 0);
+	}
+	result = MinValue<double>(result, 1);
+	return true;
+}
+
+} // namespace duckdb
@@ -44,6 +44,14 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+shared_ptr<ColumnHistogram> ColumnStatistics::GetHistogram() const {
+	return histogram;
+}
+
+void ColumnStatistics::SetHistogram(shared_ptr<ColumnHistogram> histogram_p) {
+	this->histogram = std::move(histogram_p);
+}
+
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 	if (!distinct_stats) {
 		return;
@@ -53,19 +61,29 @@ void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Copy() const {
-	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	auto result =
+	    make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	// histograms are immutable once they are built, so they can be shared
+	result->histogram = histogram;
+	return result;
 }
 
 void ColumnStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "statistics", stats);
 	serializer.WritePropertyWithDefault(101, "distinct", distinct_stats, unique_ptr<DistinctStatistics>());
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(102, "histogram", histogram, shared_ptr<ColumnHistogram>());
+	}
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Deserialize(Deserializer &deserializer) {
 	auto stats = deserializer.ReadProperty<BaseStatistics>(100, "statistics");
 	auto distinct_stats = deserializer.ReadPropertyWithDefault<unique_ptr<DistinctStatistics>>(
 	    101, "distinct", unique_ptr<DistinctStatistics>());
-	return make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	auto result = make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	result->histogram = deserializer.ReadPropertyWithDefault<shared_ptr<ColumnHistogram>>(
+	    102, "histogram", shared_ptr<ColumnHistogram>());
+	return result;
 }
 
 } // namespace duckdb
@@ -297,8 +297,10 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 		db.GetStorageExtension()->OnCheckpointStart(db, options);
 	}
 	auto &config = DBConfig::Get(db);
-	if (GetWALSize() > 0 || config.options.force_checkpoint || options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
-		// we only need to checkpoint if there is anything in the WAL
+	if (GetWALSize() > 0 || statistics_changed || config.options.force_checkpoint ||
+	    options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
+		// we only need to checkpoint if there is anything in the WAL, or if there are statistics to write
+		statistics_changed = false;
 		try {
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
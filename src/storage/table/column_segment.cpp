@@ -6,6 +6,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -513,6 +514,23 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		// copy the current filter so we do not hold the lock while filtering
+		unique_ptr<ConstantFilter> constant_filter;
+		{
+			lock_guard<mutex> l(dynamic_filter.filter_data->lock);
+			if (!dynamic_filter.filter_data->initialized) {
+				return approved_tuple_count;
+			}
+			constant_filter = make_uniq<ConstantFilter>(dynamic_filter.filter_data->filter->comparison_type,
+			                                            dynamic_filter.filter_data->filter->constant);
+		}
+		return FilterSelection(sel, vector, vdata, *constant_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -937,6 +937,10 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
+	if (new_total_rows != total_rows) {
+		// deleted rows were vacuumed - the row ids of the remaining rows have changed
+		info->IncrementRowChangeCount();
+	}
 	total_rows = new_total_rows;
 }
 
@@ -1106,4 +1110,24 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+shared_ptr<ColumnHistogram> RowGroupCollection::GetHistogram(column_t column_id) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	return stats.GetStats(*stats_lock, column_id).GetHistogram();
+}
+
+void RowGroupCollection::SetHistogram(column_t column_id, shared_ptr<ColumnHistogram> histogram) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	stats.GetStats(*stats_lock, column_id).SetHistogram(std::move(histogram));
+}
+
+vector<ColumnDependency> RowGroupCollection::GetColumnDependencies() {
+	return stats.GetColumnDependencies();
+}
+
+void RowGroupCollection::SetColumnDependencies(vector<ColumnDependency> dependencies) {
+	stats.SetColumnDependencies(std::move(dependencies));
+}
+
 } // namespace duckdb
@@ -11,6 +11,7 @@ void TableStatistics::Initialize(const vector<LogicalType> &types, PersistentTab
 
 	stats_lock = make_shared_ptr<mutex>();
 	column_stats = std::move(data.table_stats.column_stats);
+	column_dependencies = std::move(data.table_stats.column_dependencies);
 	if (column_stats.size() != types.size()) { // LCOV_EXCL_START
 		throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
 	} // LCOV_EXCL_STOP
@@ -35,6 +36,7 @@ void TableStatistics::InitializeAddColumn(TableStatistics &parent, const Logical
 		column_stats.push_back(parent.column_stats[i]);
 	}
 	column_stats.push_back(ColumnStatistics::CreateEmptyStats(new_column_type));
+	column_dependencies = parent.column_dependencies;
 }
 
 void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t removed_column) {
@@ -48,6 +50,18 @@ void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t remo
 			column_stats.push_back(parent.column_stats[i]);
 		}
 	}
+	for (auto dependency : parent.column_dependencies) {
+		if (dependency.determinant == removed_column || dependency.dependent == removed_column) {
+			continue;
+		}
+		if (dependency.determinant > removed_column) {
+			dependency.determinant--;
+		}
+		if (dependency.dependent > removed_column) {
+			dependency.dependent--;
+		}
+		column_dependencies.push_back(dependency);
+	}
 }
 
 void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed_idx, const LogicalType &new_type) {
@@ -63,6 +77,11 @@ void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed
 			column_stats.push_back(parent.column_stats[i]);
 		}
 	}
+	for (auto &dependency : parent.column_dependencies) {
+		if (dependency.determinant != changed_idx && dependency.dependent != changed_idx) {
+			column_dependencies.push_back(dependency);
+		}
+	}
 }
 
 void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
@@ -74,6 +93,7 @@ void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		column_stats.push_back(parent.column_stats[i]);
 	}
+	column_dependencies = parent.column_dependencies;
 }
 
 void TableStatistics::MergeStats(TableStatistics &other) {
@@ -100,6 +120,16 @@ ColumnStatistics &TableStatistics::GetStats(TableStatisticsLock &lock, idx_t i)
 	return *column_stats[i];
 }
 
+vector<ColumnDependency> TableStatistics::GetColumnDependencies() {
+	lock_guard<mutex> l(*stats_lock);
+	return column_dependencies;
+}
+
+void TableStatistics::SetColumnDependencies(vector<ColumnDependency> dependencies) {
+	lock_guard<mutex> l(*stats_lock);
+	column_dependencies = std::move(dependencies);
+}
+
 unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	lock_guard<mutex> l(*stats_lock);
 	auto result = column_stats[i]->Statistics().Copy();
@@ -120,11 +150,15 @@ void TableStatistics::CopyStats(TableStatisticsLock &lock, TableStatistics &othe
 	for (auto &stats : column_stats) {
 		other.column_stats.push_back(stats->Copy());
 	}
+	other.column_dependencies = column_dependencies;
 }
 
 void TableStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "column_stats", column_stats);
 	serializer.WritePropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", table_sample, nullptr);
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault<vector<ColumnDependency>>(102, "column_dependencies", column_dependencies);
+	}
 }
 
 void TableStatistics::Deserialize(Deserializer &deserializer, ColumnList &columns) {
@@ -143,6 +177,8 @@ void TableStatistics::Deserialize(Deserializer &deserializer, ColumnList &column
 		deserializer.Unset<LogicalType>();
 	});
 	table_sample = deserializer.ReadPropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", nullptr);
+	column_dependencies =
+	    deserializer.ReadPropertyWithDefault<vector<ColumnDependency>>(102, "column_dependencies");
 }
 
 unique_ptr<TableStatisticsLock> TableStatistics::GetLock() {
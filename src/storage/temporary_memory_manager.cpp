@@ -1,6 +1,7 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -48,7 +49,26 @@ void TemporaryMemoryState::SetMaterializationPenalty(idx_t new_materialization_p
 	materialization_penalty = new_materialization_penalty;
 }
 
-TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
+QueryAdmissionState::QueryAdmissionState(TemporaryMemoryManager &temporary_memory_manager_p, optional_idx query_id_p,
+                                         string query_p, idx_t estimated_memory_p)
+    : temporary_memory_manager(temporary_memory_manager_p), query_id(query_id_p), query(std::move(query_p)),
+      estimated_memory(estimated_memory_p), wait_start(std::chrono::steady_clock::now()), admitted(false),
+      timed_out(false), wait_time(0) {
+}
+
+QueryAdmissionState::~QueryAdmissionState() {
+	temporary_memory_manager.ReleaseQuery(*this);
+}
+
+idx_t QueryAdmissionState::GetEstimatedMemory() const {
+	return estimated_memory;
+}
+
+bool QueryAdmissionState::TimedOut() const {
+	return timed_out;
+}
+
+TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0), admitted_memory(0) {
 }
 
 unique_lock<mutex> TemporaryMemoryManager::Lock() {
@@ -95,6 +115,68 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
+unique_ptr<QueryAdmissionState> TemporaryMemoryManager::AdmitQuery(ClientContext &context, idx_t estimated_memory) {
+	// How often a waiting query checks whether it was interrupted
+	static constexpr std::chrono::milliseconds INTERRUPT_CHECK_INTERVAL(10);
+
+	optional_idx query_id;
+	if (context.transaction.HasActiveTransaction() && context.transaction.GetActiveQuery() != MAXIMUM_QUERY_ID) {
+		query_id = context.transaction.GetActiveQuery();
+	}
+	auto result = unique_ptr<QueryAdmissionState>(
+	    new QueryAdmissionState(*this, query_id, context.GetCurrentQuery(), estimated_memory));
+	const auto timeout = std::chrono::milliseconds(DBConfig::GetConfig(context).options.query_admission_timeout);
+	const auto deadline = result->wait_start + timeout;
+
+	auto guard = Lock();
+	UpdateConfiguration(context);
+	query_admissions.insert(*result);
+
+	// A query that needs more than the limit is admitted when it can run alone
+	const auto required_memory = MinValue(estimated_memory, memory_limit);
+	while (admitted_memory != 0 && admitted_memory + required_memory > memory_limit) {
+		if (context.interrupted) {
+			throw InterruptException();
+		}
+		const auto now = std::chrono::steady_clock::now();
+		if (now >= deadline) {
+			// We would rather let the query spill than let it wait indefinitely
+			result->timed_out = true;
+			break;
+		}
+		admission_released.wait_until(guard, MinValue(deadline, now + INTERRUPT_CHECK_INTERVAL));
+		UpdateConfiguration(context);
+	}
+	result->admitted = true;
+	result->wait_time = std::chrono::steady_clock::now() - result->wait_start;
+	admitted_memory += estimated_memory;
+	return result;
+}
+
+void TemporaryMemoryManager::ReleaseQuery(QueryAdmissionState &query_admission_state) {
+	auto guard = Lock();
+	if (query_admission_state.admitted) {
+		D_ASSERT(admitted_memory >= query_admission_state.estimated_memory);
+		admitted_memory -= query_admission_state.estimated_memory;
+		admission_released.notify_all();
+	}
+	query_admissions.erase(query_admission_state);
+}
+
+vector<QueryAdmissionInfo> TemporaryMemoryManager::GetQueryAdmissions() {
+	vector<QueryAdmissionInfo> result;
+	auto guard = Lock();
+	const auto now = std::chrono::steady_clock::now();
+	for (auto &entry : query_admissions) {
+		auto &state = entry.get();
+		const auto wait_time = state.admitted ? state.wait_time : now - state.wait_start;
+		const auto wait_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(wait_time).count();
+		result.push_back({state.query_id, state.query, state.estimated_memory, state.admitted, state.timed_out,
+		                  NumericCast<idx_t>(wait_time_ms)});
+	}
+	return result;
+}
+
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
@@ -1470,3 +1470,48 @@ TEST_CASE("Test AdbcConnectionGetObjects", "[adbc]") {
 		adbc_error.release(&adbc_error);
 	}
 }
+
+static idx_t ConsumeArrowStream(ArrowArrayStream &arrow_stream, idx_t &max_length) {
+	idx_t row_count = 0;
+	max_length = 0;
+	while (true) {
+		ArrowArray arrow_array;
+		REQUIRE(arrow_stream.get_next(&arrow_stream, &arrow_array) == 0);
+		if (!arrow_array.release) {
+			break;
+		}
+		row_count += NumericCast<idx_t>(arrow_array.length);
+		max_length = MaxValue<idx_t>(max_length, NumericCast<idx_t>(arrow_array.length));
+		arrow_array.release(&arrow_array);
+	}
+	return row_count;
+}
+
+TEST_CASE("Test ADBC streaming Arrow results", "[adbc]") {
+	if (!duckdb_lib) {
+		return;
+	}
+	ADBCTestDatabase db;
+	REQUIRE(!db.Query("SET threads=4")->HasError());
+	REQUIRE(!db.Query("CREATE TABLE integers AS SELECT i, CASE WHEN i % 7 = 0 THEN NULL ELSE i::VARCHAR END s "
+	                  "FROM range(1000000) t(i)")
+	             ->HasError());
+	string query = "SELECT * FROM integers WHERE i % 5 = 1";
+	idx_t max_length;
+
+	// by default, the result is materialized and converted one chunk at a time
+	REQUIRE(ConsumeArrowStream(db.QueryArrow(query), max_length) == 200000);
+	REQUIRE(max_length <= STANDARD_VECTOR_SIZE);
+
+	// with arrow_streaming_results, the record batches are produced by the pipeline threads
+	REQUIRE(!db.Query("SET arrow_streaming_results=true")->HasError());
+	REQUIRE(ConsumeArrowStream(db.QueryArrow(query), max_length) == 200000);
+	REQUIRE(max_length > STANDARD_VECTOR_SIZE);
+
+	// the stream is only valid until the connection runs another query, so we compare on another connection
+	auto cconn = reinterpret_cast<duckdb::Connection *>(db.adbc_connection.private_data);
+	Connection con(*cconn->context->db);
+	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, db.QueryArrow(query)));
+	query = "SELECT * FROM integers ORDER BY s DESC NULLS FIRST, i";
+	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, db.QueryArrow(query)));
+}
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/execution/executor.hpp"
 
 #include <thread>
 
@@ -237,3 +238,56 @@ TEST_CASE("Test Pending Query Prepared Statements API", "[api][.]") {
 		REQUIRE_THROWS(pending_query->Execute());
 	}
 }
+
+static bool PendingQueryIsExecutedInline(Connection &con, PendingQueryResult &pending_query) {
+	REQUIRE(!pending_query.HasError());
+	return Executor::Get(*con.context).IsExecutingInline();
+}
+
+TEST_CASE("Test that point lookups are executed on the calling thread", "[api]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE lookup(id INTEGER PRIMARY KEY, v VARCHAR)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO lookup SELECT range, range::VARCHAR FROM range(100000)"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE small AS SELECT range AS i FROM range(100)"));
+
+	// the index scan finds a single row id
+	auto pending_query = con.PendingQuery("SELECT * FROM lookup WHERE id = 7");
+	REQUIRE(PendingQueryIsExecutedInline(con, *pending_query));
+	auto result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 1, {"7"}));
+
+	// prepared lookups are executed inline as well, as long as their result is materialized
+	auto prepared = con.Prepare("SELECT * FROM lookup WHERE id = $1");
+	REQUIRE(!prepared->HasError());
+	duckdb::vector<Value> values {Value::INTEGER(7)};
+	pending_query = prepared->PendingQuery(values, false);
+	REQUIRE(PendingQueryIsExecutedInline(con, *pending_query));
+	result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 1, {"7"}));
+
+	// small tables are scanned inline
+	pending_query = con.PendingQuery("SELECT i FROM small WHERE i % 40 = 3");
+	REQUIRE(PendingQueryIsExecutedInline(con, *pending_query));
+	result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {3, 43, 83}));
+
+	// large tables are not, even if the filter is selective
+	pending_query = con.PendingQuery("SELECT * FROM lookup WHERE v = '7'");
+	REQUIRE(!PendingQueryIsExecutedInline(con, *pending_query));
+	result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {7}));
+
+	// neither are other table functions
+	pending_query = con.PendingQuery("SELECT * FROM range(10)");
+	REQUIRE(!PendingQueryIsExecutedInline(con, *pending_query));
+	result = pending_query->Execute();
+	REQUIRE(!result->HasError());
+
+	// streaming results are fetched by the client, so they are not executed inline
+	pending_query = con.PendingQuery("SELECT i FROM small WHERE i % 40 = 3", true);
+	REQUIRE(!PendingQueryIsExecutedInline(con, *pending_query));
+	result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {3, 43, 83}));
+}
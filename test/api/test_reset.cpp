@@ -94,13 +94,15 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"preserve_insertion_order", {false}},
 	    {"profile_output", {"test"}},
 	    {"profiling_mode", {"detailed"}},
+	    {"reoptimization_threshold", {Value::DOUBLE(8)}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
-	    {"allocator_flush_threshold", {"4.0 GiB"}}};
+	    {"allocator_flush_threshold", {"4.0 GiB"}},
+	    {"result_cache_size", {"4.0 GiB"}}};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
 		switch (type) {
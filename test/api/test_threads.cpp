@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <thread>
 
@@ -115,3 +116,97 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+class CountingTask : public Task {
+public:
+	explicit CountingTask(atomic<idx_t> &count) : count(count) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		count++;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	atomic<idx_t> &count;
+};
+
+TEST_CASE("Test that the scheduler divides the threads according to the query priority", "[api]") {
+	// no background threads: the tasks are only executed by this thread
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	DuckDB db(nullptr, &config);
+	Connection low_con(db);
+	Connection high_con(db);
+	REQUIRE_NO_FAIL(low_con.Query("SET query_priority=1"));
+	REQUIRE_NO_FAIL(high_con.Query("SET query_priority=3"));
+
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+	auto low_producer = scheduler.CreateProducer(*low_con.context);
+	auto high_producer = scheduler.CreateProducer(*high_con.context);
+	atomic<idx_t> low_count(0);
+	atomic<idx_t> high_count(0);
+	for (idx_t i = 0; i < 40; i++) {
+		scheduler.ScheduleTask(*low_producer, make_shared_ptr<CountingTask>(low_count));
+		scheduler.ScheduleTask(*high_producer, make_shared_ptr<CountingTask>(high_count));
+	}
+
+	// while both producers have tasks, the producer with priority 3 gets three times as many tasks
+	atomic<bool> marker(true);
+	REQUIRE(scheduler.ExecuteTasks(&marker, 40) == 40);
+	REQUIRE(low_count >= 9);
+	REQUIRE(low_count <= 11);
+	REQUIRE(high_count == 40 - low_count);
+
+	// the remaining tasks are all executed
+	REQUIRE(scheduler.ExecuteTasks(&marker, 80) == 40);
+	REQUIRE(low_count == 40);
+	REQUIRE(high_count == 40);
+}
+
+class FollowUpTask : public Task {
+public:
+	FollowUpTask(TaskScheduler &scheduler, ProducerToken &producer, atomic<idx_t> &count)
+	    : scheduler(scheduler), producer(producer), count(count), local_tasks(0) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		scheduler.ScheduleTask(producer, make_shared_ptr<CountingTask>(count));
+		for (auto &status : scheduler.GetQueueStatus()) {
+			if (status.producer_id == producer.info->producer_id) {
+				local_tasks = status.local_tasks;
+			}
+		}
+		executed = true;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	TaskScheduler &scheduler;
+	ProducerToken &producer;
+	atomic<idx_t> &count;
+	atomic<idx_t> local_tasks;
+	atomic<bool> executed {false};
+};
+
+TEST_CASE("Test that a task scheduled by a background thread is queued on that thread", "[api]") {
+	// one background thread, this thread does not execute tasks
+	DBConfig config;
+	config.options.maximum_threads = 2;
+	DuckDB db(nullptr, &config);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+
+	for (auto work_stealing : {true, false}) {
+		scheduler.SetWorkStealing(work_stealing);
+		auto producer = scheduler.CreateProducer();
+		atomic<idx_t> count(0);
+		auto task = make_shared_ptr<FollowUpTask>(scheduler, *producer, count);
+		scheduler.ScheduleTask(*producer, task);
+
+		// the background thread executes the task and then the follow-up task
+		for (idx_t i = 0; i < 10000 && count == 0; i++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		REQUIRE(task->executed);
+		REQUIRE(count == 1);
+		REQUIRE(task->local_tasks == (work_stealing ? 1 : 0));
+	}
+}
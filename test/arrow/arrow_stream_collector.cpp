@@ -0,0 +1,82 @@
+#include "catch.hpp"
+
+#include "arrow/arrow_test_helper.hpp"
+#include "duckdb/common/arrow/physical_buffered_arrow_collector.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
+#include "duckdb/main/stream_query_result.hpp"
+
+using namespace duckdb;
+
+static void TestArrowStreamCollector(Connection &con, const string &query, idx_t batch_size) {
+	// the streaming query runs on its own connection, as the arrow scan over its result runs on the other connection
+	Connection stream_con(*con.context->db);
+	unique_ptr<QueryResult> result;
+	{
+		auto &config = ClientConfig::GetConfig(*stream_con.context);
+		ScopedConfigSetting setting(
+		    config,
+		    [&batch_size](ClientConfig &config) {
+			    config.streaming_result_collector = [&batch_size](ClientContext &context, PreparedStatementData &data) {
+				    return PhysicalBufferedArrowCollector::Create(context, data, batch_size);
+			    };
+		    },
+		    [](ClientConfig &config) { config.streaming_result_collector = nullptr; });
+		result = stream_con.context->Query(query, true);
+	}
+	REQUIRE(!result->HasError());
+	REQUIRE(result->type == QueryResultType::STREAM_RESULT);
+	REQUIRE(result->Cast<StreamQueryResult>().ProducesArrowArrays());
+
+	// the stream wrapper is released by the arrow scan
+	auto wrapper = new ResultArrowArrayStreamWrapper(std::move(result), batch_size);
+	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, wrapper->stream));
+}
+
+TEST_CASE("Test streaming Arrow record batches produced by the pipelines", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i, CASE WHEN i % 7 = 0 THEN NULL ELSE i::VARCHAR END s, "
+	                          "CASE WHEN i % 3 = 0 THEN NULL ELSE i * 2 END j FROM range(1000000) t(i)"));
+
+	SECTION("Order preserving") {
+		TestArrowStreamCollector(con, "SELECT * FROM integers", 10000);
+		TestArrowStreamCollector(con, "SELECT * FROM integers", 1000000);
+		TestArrowStreamCollector(con, "SELECT i + 1, s, j FROM integers WHERE i % 5 = 1", 1000);
+		TestArrowStreamCollector(con, "SELECT * FROM integers ORDER BY j DESC NULLS FIRST, i", 4096);
+	}
+	SECTION("Not order preserving") {
+		REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=false"));
+		TestArrowStreamCollector(con, "SELECT * FROM integers", 10000);
+		TestArrowStreamCollector(con, "SELECT j, s FROM integers WHERE i % 5 = 1", 777);
+	}
+	SECTION("Empty result") {
+		TestArrowStreamCollector(con, "SELECT * FROM integers WHERE i < 0", 10000);
+	}
+}
+
+TEST_CASE("Test streaming Arrow record batches with an error", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	Connection stream_con(db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE strings AS SELECT CASE WHEN i = 500000 THEN 'hello' ELSE i::VARCHAR END "
+	                          "s FROM range(1000000) t(i)"));
+
+	auto &config = ClientConfig::GetConfig(*stream_con.context);
+	config.streaming_result_collector = [](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalBufferedArrowCollector::Create(context, data, 10000);
+	};
+	auto result = stream_con.context->Query("SELECT s::INTEGER FROM strings", true);
+	config.streaming_result_collector = nullptr;
+	REQUIRE(!result->HasError());
+
+	auto &stream_result = result->Cast<StreamQueryResult>();
+	while (true) {
+		auto array = stream_result.FetchArrowArray();
+		if (!array) {
+			break;
+		}
+	}
+	REQUIRE(stream_result.HasError());
+	REQUIRE(StringUtil::Contains(stream_result.GetError(), "Conversion Error"));
+}
@@ -378,6 +378,10 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! dynamic filters are only known during execution, so they cannot be pushed into the Arrow scan
+		return import_cache.pyarrow.dataset().attr("scalar")(true);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}
@@ -5,6 +5,7 @@
 #include "duckdb_python/pyresult.hpp"
 #include "duckdb/parser/qualified_name.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/common/arrow/physical_buffered_arrow_collector.hpp"
 #include "duckdb_python/numpy/numpy_type.hpp"
 #include "duckdb/main/relation/query_relation.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -956,6 +957,20 @@ duckdb::pyarrow::RecordBatchReader DuckDBPyRelation::ToRecordBatch(idx_t batch_s
 		if (!rel) {
 			return py::none();
 		}
+		// the record batches are produced by the pipeline threads, the reader only hands them out
+		// an invalid batch size is reported by the reader
+		auto &config = ClientConfig::GetConfig(*rel->context.GetContext());
+		ScopedConfigSetting setting(
+		    config,
+		    [batch_size](ClientConfig &config) {
+			    if (batch_size == 0) {
+				    return;
+			    }
+			    config.streaming_result_collector = [batch_size](ClientContext &context, PreparedStatementData &data) {
+				    return PhysicalBufferedArrowCollector::Create(context, data, batch_size);
+			    };
+		    },
+		    [](ClientConfig &config) { config.streaming_result_collector = nullptr; });
 		ExecuteOrThrow(true);
 	}
 	AssertResultOpen();
@@ -237,6 +237,22 @@ class TestArrowFetchRecordBatch(object):
         chunk = record_batch_reader.read_next_batch()
         assert len(chunk) == 3000
 
+    def test_record_batch_reader_from_relation_parallel(self, duckdb_cursor):
+        duckdb_cursor = duckdb.connect()
+        duckdb_cursor.execute("SET threads=4")
+        duckdb_cursor.execute(
+            "CREATE table t as select range a, CASE WHEN range % 7 = 0 THEN NULL ELSE range::VARCHAR END b "
+            "from range(1000000);"
+        )
+        relation = duckdb_cursor.sql('SELECT * FROM t WHERE a % 3 = 1')
+        record_batch_reader = relation.record_batch(100000)
+        batches = list(record_batch_reader)
+        assert all(len(batch) <= 100000 for batch in batches)
+        assert sum(len(batch) for batch in batches) == 333333
+        res = pa.Table.from_batches(batches, record_batch_reader.schema)
+        correct = duckdb_cursor.execute("SELECT * FROM t WHERE a % 3 = 1").fetch_arrow_table()
+        assert res.equals(correct)
+
     def test_record_coverage(self, duckdb_cursor):
         duckdb_cursor = duckdb.connect()
         duckdb_cursor.execute("CREATE table t as select range a from range(2048);")